@@ -0,0 +1,11 @@
+#!/bin/bash
+
+source ../Demo/setupEnvironment.sh
+
+rm -Rf build
+mkdir build
+cd build
+cmake ../ -DCMAKE_BUILD_TYPE=Release
+make -j `nproc` || exit 1
+cd ..
+echo "Build was made in build/ directory"
@@ -0,0 +1,259 @@
+#include <LogIt.h>
+#include <Oid.h>
+#include <OidCache.h>
+#include <SnmpBackend.h>
+#include <SnmpLibrary.h>
+#include <MuleLogComponents.h>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+/*
+ *    Network free micro benchmarks of the client hot path: OID handling, PDU construction,
+ *    response decoding, walk termination and SET value encoding. Run with --benchmark_filter
+ *    to select, compare runs with compare.py of Google Benchmark.
+ */
+
+namespace
+{
+
+const std::string SYS_UP_TIME = "1.3.6.1.2.1.1.3.0";
+const std::string IF_DESCR_1 = "1.3.6.1.2.1.2.2.1.2.1";
+// Deep enough to leave the inline storage of Oid
+const std::string LONG_OID = "1.3.6.1.4.1.9.9.91.1.1.1.1.4.1.2.3.4.5.6.7.8.9.10.11.12.13.14";
+
+/*
+ *    Response PDU with a single varbind, as the library hands it over after parsing
+ */
+Snmp::PduPtr makeResponse( u_char type, const void * value, size_t length )
+{
+    const Snmp::Oid name( IF_DESCR_1 );
+    Snmp::PduPtr response( snmp_pdu_create( SNMP_MSG_RESPONSE ) );
+    snmp_pdu_add_variable( response.get(), name.data(), name.size(), type, value, length );
+    return response;
+}
+
+template <typename T>
+void decodeResponse( benchmark::State& state, u_char type, const void * value, size_t length )
+{
+    const Snmp::Oid name( IF_DESCR_1 );
+    const Snmp::PduPtr response = makeResponse( type, value, length );
+    for ( auto _ : state )
+        benchmark::DoNotOptimize( Snmp::SnmpBackend::decodeResponse<T>( response.get(), name ) );
+}
+
+}
+
+/*
+ *    OID handling
+ */
+
+static void BM_OidParseNumeric( benchmark::State& state )
+{
+    const std::string& oidString = state.range(0) ? LONG_OID : SYS_UP_TIME;
+    for ( auto _ : state )
+        benchmark::DoNotOptimize( Snmp::Oid( oidString ) );
+}
+BENCHMARK(BM_OidParseNumeric)->Arg(0)->Arg(1);
+
+// What SnmpBackend::prepareOid does for every call taking a string
+static void BM_OidCacheGet( benchmark::State& state )
+{
+    const std::string& oidString = state.range(0) ? LONG_OID : SYS_UP_TIME;
+    Snmp::OidCache::instance().get( oidString );
+    for ( auto _ : state )
+        benchmark::DoNotOptimize( Snmp::OidCache::instance().get( oidString ) );
+}
+BENCHMARK(BM_OidCacheGet)->Arg(0)->Arg(1);
+
+static void BM_OidAssign( benchmark::State& state )
+{
+    const Snmp::Oid source( state.range(0) ? LONG_OID : SYS_UP_TIME );
+    Snmp::Oid destination;
+    for ( auto _ : state )
+    {
+        destination.assign( source.data(), source.size() );
+        benchmark::DoNotOptimize( destination );
+    }
+}
+BENCHMARK(BM_OidAssign)->Arg(0)->Arg(1);
+
+// What SnmpBackend::oidToString does
+static void BM_OidToString( benchmark::State& state )
+{
+    const Snmp::Oid source( state.range(0) ? LONG_OID : SYS_UP_TIME );
+    for ( auto _ : state )
+        benchmark::DoNotOptimize( source.getOidString() );
+}
+BENCHMARK(BM_OidToString)->Arg(0)->Arg(1);
+
+static void BM_OidCompare( benchmark::State& state )
+{
+    const Snmp::Oid first( IF_DESCR_1 );
+    Snmp::Oid second( IF_DESCR_1 );
+    second.append( 1 );
+    for ( auto _ : state )
+        benchmark::DoNotOptimize( first.compare( second ) );
+}
+BENCHMARK(BM_OidCompare);
+
+/*
+ *    PDU construction, one GET of range(0) varbinds as snmpGetMany packs them
+ */
+
+static void BM_PduBuildGet( benchmark::State& state )
+{
+    const Snmp::Oid name( IF_DESCR_1 );
+    for ( auto _ : state )
+    {
+        Snmp::PduPtr pdu( snmp_pdu_create( SNMP_MSG_GET ) );
+        for ( int64_t i = 0; i < state.range(0); i++ )
+            snmp_add_null_var( pdu.get(), name.data(), name.size() );
+        benchmark::DoNotOptimize( pdu.get() );
+    }
+    state.SetItemsProcessed( state.iterations() * state.range(0) );
+}
+BENCHMARK(BM_PduBuildGet)->Arg(1)->Arg(16)->Arg(Snmp::Constants::SNMP_MAX_VARBINDS_PER_PDU);
+
+static void BM_PduBuildGetBulk( benchmark::State& state )
+{
+    const Snmp::Oid name( IF_DESCR_1 );
+    for ( auto _ : state )
+    {
+        Snmp::PduPtr pdu( snmp_pdu_create( SNMP_MSG_GETBULK ) );
+        pdu->non_repeaters = 0;
+        pdu->max_repetitions = Snmp::Constants::SNMP_WALK_MAX_REPETITIONS;
+        snmp_add_null_var( pdu.get(), name.data(), name.size() );
+        benchmark::DoNotOptimize( pdu.get() );
+    }
+}
+BENCHMARK(BM_PduBuildGetBulk);
+
+/*
+ *    Response decoding, per type of the snmpGet* family
+ */
+
+static void BM_DecodeInt32( benchmark::State& state )
+{
+    const long value = -42;
+    decodeResponse<int32_t>( state, ASN_INTEGER, &value, sizeof value );
+}
+BENCHMARK(BM_DecodeInt32);
+
+static void BM_DecodeUInt32( benchmark::State& state )
+{
+    const long value = 4000000000;
+    decodeResponse<uint32_t>( state, ASN_COUNTER, &value, sizeof value );
+}
+BENCHMARK(BM_DecodeUInt32);
+
+static void BM_DecodeString( benchmark::State& state )
+{
+    const std::string value( state.range(0), 'x' );
+    decodeResponse<std::string>( state, ASN_OCTET_STR, value.data(), value.size() );
+}
+BENCHMARK(BM_DecodeString)->Arg(8)->Arg(255);
+
+static void BM_DecodeStringView( benchmark::State& state )
+{
+    const std::string value( state.range(0), 'x' );
+    decodeResponse<std::string_view>( state, ASN_OCTET_STR, value.data(), value.size() );
+}
+BENCHMARK(BM_DecodeStringView)->Arg(8)->Arg(255);
+
+static void BM_DecodeHex( benchmark::State& state )
+{
+    const std::vector<uint8_t> value( 6, 0xab );
+    decodeResponse<std::vector<uint8_t>>( state, ASN_OCTET_STR, value.data(), value.size() );
+}
+BENCHMARK(BM_DecodeHex);
+
+static void BM_DecodeCounter64( benchmark::State& state )
+{
+    struct counter64 value;
+    value.high = 1;
+    value.low = 42;
+    decodeResponse<uint64_t>( state, ASN_COUNTER64, &value, sizeof value );
+}
+BENCHMARK(BM_DecodeCounter64);
+
+// What snmpGetFloatFromString spends once the string is received
+static void BM_FloatFromString( benchmark::State& state )
+{
+    const std::string_view value( "23.875" );
+    for ( auto _ : state )
+        benchmark::DoNotOptimize( Snmp::SnmpBackend::floatFromString( value ) );
+}
+BENCHMARK(BM_FloatFromString);
+
+// The untyped decoding of snmpGetMany, snmpWalk and snmpGetTable
+static void BM_DecodeVariable( benchmark::State& state )
+{
+    const long value = 42;
+    const Snmp::PduPtr response = makeResponse( ASN_INTEGER, &value, sizeof value );
+    for ( auto _ : state )
+        benchmark::DoNotOptimize( Snmp::SnmpBackend::decodeVariable( response->variables ) );
+}
+BENCHMARK(BM_DecodeVariable);
+
+/*
+ *    Walk termination, evaluated for every walked varbind
+ */
+
+static void BM_IsEndOfWalk( benchmark::State& state )
+{
+    const long value = 1;
+    const Snmp::PduPtr response = makeResponse( ASN_INTEGER, &value, sizeof value );
+    const Snmp::Oid current( IF_DESCR_1 );
+    const Snmp::Oid next( "1.3.6.1.2.1.2.2.1.2.2" );
+    for ( auto _ : state )
+        benchmark::DoNotOptimize( Snmp::SnmpBackend::isEndOfWalk( current, next, response->variables ) );
+}
+BENCHMARK(BM_IsEndOfWalk);
+
+/*
+ *    SET value encoding, per alternative of snmpSetValue
+ */
+
+static void setEncode( benchmark::State& state, const Snmp::snmpSetValue& value )
+{
+    const Snmp::Oid name( IF_DESCR_1 );
+    for ( auto _ : state )
+    {
+        Snmp::PduPtr pdu( snmp_pdu_create( SNMP_MSG_SET ) );
+        benchmark::DoNotOptimize( Snmp::SnmpBackend::addSetVarbind( pdu.get(), name, value ) );
+    }
+}
+
+static void BM_SetEncodeInt32( benchmark::State& state ) { setEncode( state, int32_t(-42) ); }
+static void BM_SetEncodeUInt32( benchmark::State& state ) { setEncode( state, uint32_t(42) ); }
+static void BM_SetEncodeString( benchmark::State& state ) { setEncode( state, std::string( "mule benchmark" ) ); }
+static void BM_SetEncodeBoolean( benchmark::State& state ) { setEncode( state, true ); }
+static void BM_SetEncodeCounter64( benchmark::State& state ) { setEncode( state, uint64_t(1) << 40 ); }
+BENCHMARK(BM_SetEncodeInt32);
+BENCHMARK(BM_SetEncodeUInt32);
+BENCHMARK(BM_SetEncodeString);
+BENCHMARK(BM_SetEncodeBoolean);
+BENCHMARK(BM_SetEncodeCounter64);
+
+int main(int argc, char** argv)
+{
+    Log::initializeLogging(Log::ERR);
+    Mule::LogComponentLevels::initializeMule(Log::ERR);
+
+    // Numeric OIDs only, MIB parsing is not on the hot path
+    Snmp::SnmpLibraryOptions options;
+    options.mibLoading = Snmp::SnmpLibraryOptions::MibLoading::None;
+    options.readConfigurationFiles = false;
+    Snmp::SnmpLibrary::initialize(options);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    return 0;
+}
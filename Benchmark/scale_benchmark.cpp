@@ -0,0 +1,141 @@
+#include <LogIt.h>
+#include <SnmpBackend.h>
+#include <SnmpLibrary.h>
+#include <SnmpSimulator.h>
+#include <MuleLogComponents.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ *	Polls N simulated devices from M threads for a while, each request a GET of the
+ *	interface counters of a device, and reports throughput and latency percentiles.
+ *	Without a walk file every device gets a generated image of 16 interfaces; with one, the
+ *	polled OIDs must exist in it or the answers are noSuchObject.
+ *
+ *	usage: scale_benchmark [devices] [threads] [seconds] [latencyUs] [walk file]
+ */
+
+namespace
+{
+
+const size_t INTERFACES = 16;
+const std::string IF_IN_OCTETS = "1.3.6.1.2.1.2.2.1.10.";
+const std::string IF_OUT_OCTETS = "1.3.6.1.2.1.2.2.1.16.";
+
+std::shared_ptr<Snmp::SnmpDeviceImage> generatedImage()
+{
+    auto image = std::make_shared<Snmp::SnmpDeviceImage>();
+    image->setString(Snmp::Oid("1.3.6.1.2.1.1.1.0"), "Simulated device");
+    image->setInteger(Snmp::Oid("1.3.6.1.2.1.1.3.0"), 123456, ASN_TIMETICKS);
+    image->setInteger(Snmp::Oid("1.3.6.1.2.1.2.1.0"), INTERFACES);
+    for (size_t i = 1; i <= INTERFACES; i++)
+    {
+        const std::string index = std::to_string(i);
+        image->setString(Snmp::Oid("1.3.6.1.2.1.2.2.1.2." + index), "eth" + index);
+        image->setInteger(Snmp::Oid(IF_IN_OCTETS + index), 1000 * i, ASN_COUNTER);
+        image->setInteger(Snmp::Oid(IF_OUT_OCTETS + index), 2000 * i, ASN_COUNTER);
+    }
+    return image;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    Log::initializeLogging(Log::WRN);
+    Mule::LogComponentLevels::initializeMule(Log::WRN);
+
+    const size_t deviceCount = argc > 1 ? std::stoul(argv[1]) : 100;
+    const size_t threadCount = argc > 2 ? std::stoul(argv[2]) : 4;
+    const int seconds = argc > 3 ? std::stoi(argv[3]) : 10;
+
+    if (deviceCount == 0 || threadCount == 0)
+    {
+        LOG(Log::ERR) << "usage: scale_benchmark [devices] [threads] [seconds] [latencyUs] [walk file], devices and threads at least 1";
+        return 1;
+    }
+
+    Snmp::SnmpSimulatedDeviceOptions deviceOptions;
+    deviceOptions.latencyUs = argc > 4 ? std::stoi(argv[4]) : 0;
+
+    std::shared_ptr<Snmp::SnmpDeviceImage> image;
+    if (argc > 5)
+    {
+        image = std::make_shared<Snmp::SnmpDeviceImage>();
+        image->loadWalkFile(argv[5]);
+    }
+    else
+    {
+        image = generatedImage();
+    }
+
+    Snmp::SnmpLibrary::initialize();
+    Snmp::SnmpSimulator simulator;
+
+    std::vector<std::unique_ptr<Snmp::SnmpBackend>> devices;
+    devices.reserve(deviceCount);
+    for (size_t i = 0; i < deviceCount; i++)
+    {
+        const uint16_t port = simulator.addDevice(image, deviceOptions);
+        devices.push_back(std::make_unique<Snmp::SnmpBackend>("127.0.0.1:" + std::to_string(port), "2c", "public", 0));
+    }
+
+    std::vector<Snmp::Oid> polled;
+    for (size_t i = 1; i <= INTERFACES; i++)
+    {
+        polled.emplace_back(IF_IN_OCTETS + std::to_string(i));
+        polled.emplace_back(IF_OUT_OCTETS + std::to_string(i));
+    }
+
+    // Threads poll devices round robin, each from its own share of the devices
+    std::atomic<bool> running(true);
+    std::atomic<uint64_t> failures(0);
+    std::vector<std::thread> threads;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&, t]()
+        {
+            for (size_t i = t; running; i += threadCount)
+            {
+                for (const auto& result : devices[i % deviceCount]->snmpGetMany(polled))
+                {
+                    if (result.first != Snmp::Snmp_Good)
+                    {
+                        failures++;
+                        break;
+                    }
+                }
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    running = false;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    const auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<Snmp::SnmpMetrics::Snapshot> snapshots;
+    for (const auto& device : devices)
+    {
+        snapshots.push_back(device->getMetrics());
+    }
+    const Snmp::SnmpMetrics::Snapshot total = Snmp::SnmpMetrics::Snapshot::aggregate(snapshots);
+    const Snmp::SnmpSimulator::Statistics statistics = simulator.getStatistics();
+
+    LOG(Log::WRN) << deviceCount << " devices, " << threadCount << " threads, " << polled.size() << " varbinds per request";
+    LOG(Log::WRN) << "Requests: " << total.totalRequests() << ", " << (elapsedUs ? total.totalRequests() * 1000000 / elapsedUs : 0) << " per second"
+                  << ", failed: " << failures << ", timeouts: " << total.timeouts;
+    LOG(Log::WRN) << "Latency p50: " << total.latencyPercentileUs(0.5) << " us, p99: " << total.latencyPercentileUs(0.99) << " us";
+    LOG(Log::WRN) << "Simulator requests: " << statistics.requests << ", responses: " << statistics.responses << ", dropped: " << statistics.dropped;
+
+    return 0;
+}
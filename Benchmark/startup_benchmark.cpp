@@ -0,0 +1,51 @@
+#include <LogIt.h>
+#include <SnmpBackend.h>
+#include <SnmpLibrary.h>
+#include <MuleLogComponents.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <cstring>
+
+/*
+ *	Measures the construction time of N backends, i.e. the server start up cost of N devices.
+ *	No request is sent, so any address will do.
+ *
+ *	usage: startup_benchmark [backends] [hostname] [--no-mibs]
+ */
+int main(int argc, char** argv)
+{
+    Log::initializeLogging(Log::WRN);
+    Mule::LogComponentLevels::initializeMule(Log::WRN);
+
+    const size_t backends = argc > 1 ? std::stoul(argv[1]) : 1000;
+    const std::string hostname = argc > 2 ? argv[2] : "127.0.0.1";
+
+    Snmp::SnmpLibraryOptions options;
+    if (argc > 3 && std::strcmp(argv[3], "--no-mibs") == 0)
+    {
+        options.mibLoading = Snmp::SnmpLibraryOptions::MibLoading::None;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    Snmp::SnmpLibrary::initialize(options);
+    const auto initialized = std::chrono::steady_clock::now();
+
+    std::vector<std::unique_ptr<Snmp::SnmpBackend>> devices;
+    devices.reserve(backends);
+    for (size_t i = 0; i < backends; i++)
+    {
+        devices.push_back(std::make_unique<Snmp::SnmpBackend>(hostname, "2c", "public", Snmp::Constants::SNMP_MAX_RETRIES));
+    }
+    const auto constructed = std::chrono::steady_clock::now();
+
+    const auto initializationUs = std::chrono::duration_cast<std::chrono::microseconds>(initialized - start).count();
+    const auto constructionUs = std::chrono::duration_cast<std::chrono::microseconds>(constructed - initialized).count();
+
+    LOG(Log::WRN) << "Library initialization: " << initializationUs << " us";
+    LOG(Log::WRN) << "Construction of " << backends << " backends: " << constructionUs << " us, "
+                  << (backends ? constructionUs / backends : 0) << " us per backend";
+
+    return 0;
+}
@@ -1,6 +1,7 @@
 #include <LogIt.h>
 #include <SnmpBackend.h>
 #include <SnmpDefinitions.h>
+#include <SnmpWalkSnapshot.h>
 #include <MuleLogComponents.h>
 
 int main()
@@ -29,6 +30,18 @@ int main()
             LOG(Log::INF) << "Acquired board " << boardNumber << " presence: " << std::boolalpha << (bool)boardPresence.second;
         }
         
+        LOG(Log::INF) << "Start reading board presence in one go";
+        std::vector<std::string> boardPresenceOids;
+        for (int boardNumber = 1 ; boardNumber <= 14 ; boardNumber++)
+        {
+            boardPresenceOids.push_back(boardPresent + "." + std::to_string(boardNumber));
+        }
+        auto boardPresences = snmpBackend.snmpGetMany(boardPresenceOids);
+        for (size_t i = 0 ; i < boardPresences.size() ; i++)
+        {
+            LOG(Log::INF) << "Acquired " << boardPresenceOids[i] << " status: 0x" << std::hex << boardPresences[i].first;
+        }
+
         LOG(Log::INF) << "Start walking board presence";
         auto oids = snmpBackend.snmpDeviceWalk(boardPresent + ".0");
 
@@ -37,6 +50,31 @@ int main()
         {
             oid.printOidFromVector();
         }
+
+        LOG(Log::INF) << "Streaming the board presence values";
+        snmpBackend.snmpWalk<int32_t>(Snmp::Oid(boardPresent), [](const Snmp::Oid& oid, int32_t present)
+        {
+            LOG(Log::INF) << oid << " present: " << present;
+            return true;
+        });
+
+        LOG(Log::INF) << "Reading board 1 presence without exceptions";
+        auto presence = snmpBackend.trySnmpGet<int32_t>(boardPresent + ".1");
+        if (presence.ok())
+        {
+            LOG(Log::INF) << "Board 1 present: " << presence.value;
+        }
+        else
+        {
+            LOG(Log::INF) << "Board 1 presence unknown: " << presence.error.toString();
+        }
+
+        LOG(Log::INF) << "Saving the board presence walk for the next start";
+        const std::string snapshotPath = "/tmp/mule_demo.snapshot";
+        Snmp::SnmpWalkSnapshot::capture(snmpBackend, {Snmp::Oid(boardPresent)}, snapshotPath);
+        Snmp::SnmpWalkSnapshot snapshot(snapshotPath);
+        LOG(Log::INF) << "Snapshot of " << snapshot.size() << " OIDs is "
+                      << Snmp::SnmpWalkSnapshot::validationToString(snapshot.validate(snmpBackend));
         
     }
     catch (const std::exception &e)
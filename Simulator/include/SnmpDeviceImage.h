@@ -0,0 +1,99 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <istream>
+
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+
+#include <Oid.h>
+
+namespace Snmp
+{
+
+/**
+ * MIB content of a simulated device: every OID with its ASN.1 type and value, in walk order.
+ * Usually loaded from the output of snmpwalk -On on a real device.
+ */
+class SnmpDeviceImage
+{
+
+public:
+	struct Value
+	{
+		u_char type;
+		// as net-snmp stores it: long for integer types, struct counter64, oid array, raw bytes otherwise
+		std::string data;
+	};
+
+	typedef std::map<Oid, Value> Values;
+
+	SnmpDeviceImage() = default;
+
+	/**
+	 * Reads snmpwalk -On output (e.g. ".1.3.6.1.2.1.1.3.0 = Timeticks: (123) 0:00:01.23"),
+	 * including strings spanning lines. Lines of types which cannot be represented are skipped.
+	 * @return number of OIDs loaded
+	 */
+	size_t loadWalk( std::istream& input );
+	size_t loadWalkFile( const std::string& path );
+
+	/**
+	 * @param value as for snmp_pdu_add_variable
+	 */
+	void set( const Oid& name, u_char type, const void * value, size_t length );
+	void setInteger( const Oid& name, long value, u_char type = ASN_INTEGER );
+	void setString( const Oid& name, const std::string& value );
+
+	/**
+	 * @return the value of name, nullptr when absent
+	 */
+	const Value * find( const Oid& name ) const;
+
+	/**
+	 * @return first OID after name in walk order, end() past the last one
+	 */
+	Values::const_iterator next( const Oid& name ) const { return m_values.upper_bound( name ); };
+	Values::const_iterator end() const { return m_values.end(); };
+
+	size_t size() const { return m_values.size(); };
+
+private:
+	bool parseValue( const std::string& type, const std::string& text, Value& value ) const;
+
+	Values m_values;
+
+};
+
+} // Snmp
@@ -0,0 +1,164 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <map>
+#include <queue>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <random>
+#include <chrono>
+
+#include <SnmpDeviceImage.h>
+#include <SnmpBackend.h>
+
+namespace Snmp
+{
+
+struct SnmpSimulatedDeviceOptions
+{
+	std::string address = "127.0.0.1";
+	// 0 lets the system choose, see SnmpSimulator::addDevice
+	uint16_t port = 0;
+	std::string community = "public";
+	bool writable = true;
+	// delay of every response: fixed part plus a uniformly distributed extra, in us
+	int latencyUs = 0;
+	int jitterUs = 0;
+	// probability of a request being dropped without response, in [0, 1]
+	double lossProbability = 0.0;
+	// above this many varbinds GET, GETNEXT and SET are answered tooBig and GETBULK responses
+	// are truncated, 0 for no limit
+	size_t maxVarbinds = 0;
+};
+
+/**
+ * SNMPv1/v2c agents on loopback UDP ports, answering GET, GETNEXT, GETBULK and SET from a
+ * device image, for tests and benchmarks of SnmpBackend without real devices. Thousands of
+ * devices can share a simulator: one thread serves them all. Devices may share one image, the
+ * values they are SET to stay per device.
+ *
+ * SNMPv3 is not simulated: agents and clients in one process would share the local engine ID
+ * and the USM user table of net-snmp.
+ */
+class SnmpSimulator
+{
+
+public:
+	struct Statistics
+	{
+		uint64_t requests = 0;
+		uint64_t responses = 0;
+		// lost on purpose, or with a wrong community
+		uint64_t dropped = 0;
+	};
+
+	explicit SnmpSimulator( unsigned int seed = std::random_device()() );
+	~SnmpSimulator();
+
+	// CppCoreGuidelines C.21
+	SnmpSimulator(const SnmpSimulator&) = delete;
+	SnmpSimulator& operator=(const SnmpSimulator&) = delete;
+	SnmpSimulator(SnmpSimulator&&) = delete;
+	SnmpSimulator& operator=(SnmpSimulator&&) = delete;
+
+	/**
+	 * Starts answering on a new port. Thread safe. Mind the open files limit with many devices.
+	 * @return the bound port, for a peer name such as "127.0.0.1:port"
+	 */
+	uint16_t addDevice( std::shared_ptr<const SnmpDeviceImage> image, const SnmpSimulatedDeviceOptions& options = SnmpSimulatedDeviceOptions() );
+
+	size_t deviceCount() const;
+	Statistics getStatistics() const;
+
+private:
+
+	struct Device
+	{
+		SnmpSimulator * simulator;
+		std::shared_ptr<const SnmpDeviceImage> image;
+		// values written by SET, over the image
+		SnmpDeviceImage::Values written;
+		SnmpSimulatedDeviceOptions options;
+		void * sessp;
+		uint16_t port;
+	};
+
+	struct DelayedResponse
+	{
+		std::chrono::steady_clock::time_point due;
+		void * sessp;
+		netsnmp_pdu * response;
+		bool operator>( const DelayedResponse& other ) const { return due > other.due; };
+	};
+
+	void eventLoop();
+	void wakeUp();
+	void sendDueResponses();
+	void send( void * sessp, netsnmp_pdu * response );
+
+	static int requestCallback( int operation, netsnmp_session *session, int reqid, netsnmp_pdu *pdu, void *magic );
+	void processRequest( Device& device, netsnmp_pdu * request );
+
+	// Answers, nullptr when the request is to be dropped
+	netsnmp_pdu * answer( Device& device, netsnmp_pdu * request );
+	void answerGet( Device& device, netsnmp_pdu * request, netsnmp_pdu * response );
+	void answerGetNext( Device& device, netsnmp_pdu * request, netsnmp_pdu * response );
+	void answerGetBulk( Device& device, netsnmp_pdu * request, netsnmp_pdu * response );
+	void answerSet( Device& device, netsnmp_pdu * request, netsnmp_pdu * response );
+	void setError( netsnmp_pdu * request, netsnmp_pdu * response, long errorStatus, long errorIndex );
+
+	const SnmpDeviceImage::Value * find( const Device& device, const Oid& name ) const;
+	static void addValue( netsnmp_pdu * response, const Oid& name, const SnmpDeviceImage::Value& value );
+
+	mutable std::mutex m_devicesMutex;
+	std::vector<std::unique_ptr<Device>> m_devices;
+	bool m_devicesChanged;
+
+	// Touched by the loop thread only
+	std::priority_queue<DelayedResponse, std::vector<DelayedResponse>, std::greater<DelayedResponse>> m_delayed;
+	std::mt19937 m_random;
+
+	std::atomic<uint64_t> m_requests;
+	std::atomic<uint64_t> m_responses;
+	std::atomic<uint64_t> m_dropped;
+
+	std::atomic<bool> m_running;
+	int m_wakeUpPipe[2];
+	std::thread m_thread;
+
+};
+
+} // Snmp
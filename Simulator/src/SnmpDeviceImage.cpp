@@ -0,0 +1,294 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <SnmpDeviceImage.h>
+#include <SnmpExceptions.h>
+#include <MuleLogComponents.h>
+
+#include <fstream>
+#include <sstream>
+#include <cstdlib>
+
+#include <arpa/inet.h>
+
+using Mule::LogComponentLevels;
+
+namespace Snmp
+{
+
+namespace
+{
+
+std::string fromLong( long value )
+{
+	return std::string( reinterpret_cast<const char*>(&value), sizeof value );
+}
+
+/*
+ *	"up(1)" and "1" both give 1, so do "(123) 0:00:01.23" and "42 C"
+ */
+bool parseNumber( const std::string& text, long long& number, bool isUnsigned )
+{
+	const size_t open = text.find( '(' );
+	const std::string digits = open == std::string::npos ? text : text.substr( open + 1 );
+	const char * begin = digits.c_str();
+	char * end = nullptr;
+	number = isUnsigned ? static_cast<long long>( std::strtoull( begin, &end, 10 ) ) : std::strtoll( begin, &end, 10 );
+	return end != begin;
+}
+
+/*
+ *	"00 1A 2B" to bytes, stops at the first token which is not a hex byte (BITS append names)
+ */
+std::string parseHex( const std::string& text )
+{
+	std::string bytes;
+	std::istringstream tokens( text );
+	std::string token;
+	while ( tokens >> token )
+	{
+		if ( token.size() != 2 || !isxdigit( static_cast<unsigned char>(token[0]) ) || !isxdigit( static_cast<unsigned char>(token[1]) ) )
+			break;
+		bytes.push_back( static_cast<char>( std::strtoul( token.c_str(), nullptr, 16 ) ) );
+	}
+	return bytes;
+}
+
+std::string unquote( const std::string& text )
+{
+	if ( text.size() < 2 || text.front() != '"' || text.back() != '"' )
+		return text;
+
+	std::string unquoted;
+	for ( size_t i = 1; i + 1 < text.size(); i++ )
+	{
+		if ( text[i] == '\\' && i + 2 < text.size() )
+			i++;
+		unquoted.push_back( text[i] );
+	}
+	return unquoted;
+}
+
+/*
+ *	A quoted string goes on while its closing quote is missing
+ */
+bool isOpenString( const std::string& text )
+{
+	if ( text.empty() || text.front() != '"' )
+		return false;
+	if ( text.size() == 1 )
+		return true;
+	size_t backslashes = 0;
+	for ( size_t i = text.size() - 1; i > 0 && text[i - 1] == '\\'; i-- )
+		backslashes++;
+	return text.back() != '"' || backslashes % 2 == 1;
+}
+
+}
+
+size_t SnmpDeviceImage::loadWalkFile( const std::string& path )
+{
+
+	std::ifstream input( path );
+	if ( !input )
+		snmp_throw_runtime_error_with_origin("Cannot open walk file " + path);
+
+	return loadWalk( input );
+
+}
+
+size_t SnmpDeviceImage::loadWalk( std::istream& input )
+{
+
+	size_t loaded = 0;
+	size_t skipped = 0;
+
+	std::string line;
+	std::string pending;
+
+	auto flush = [&] () {
+		if ( pending.empty() )
+			return;
+
+		const size_t equals = pending.find( " = " );
+		const std::string name = pending.substr( 0, equals );
+		std::string rest = pending.substr( equals + 3 );
+		pending.clear();
+
+		std::string type = "STRING";
+		const size_t colon = rest.find( ": " );
+		if ( rest == "\"\"" )
+			rest.clear();
+		else if ( colon != std::string::npos )
+		{
+			type = rest.substr( 0, colon );
+			rest = rest.substr( colon + 2 );
+		}
+		else if ( !rest.empty() && rest.back() == ':' )
+		{
+			type = rest.substr( 0, rest.size() - 1 );
+			rest.clear();
+		}
+
+		Value value;
+		try
+		{
+			if ( parseValue( type, rest, value ) )
+			{
+				m_values[ Oid( name ) ] = std::move( value );
+				loaded++;
+				return;
+			}
+		}
+		catch (const std::exception& e)
+		{
+			LOG(Log::DBG, LogComponentLevels::mule()) << "Walk line of " << name << " not loaded: " << e.what();
+		}
+		skipped++;
+	};
+
+	while ( std::getline( input, line ) )
+	{
+		if ( !line.empty() && line.back() == '\r' )
+			line.pop_back();
+
+		// Continuation of a multi-line string or hex string
+		if ( line.find( " = " ) == std::string::npos || line[0] != '.' )
+		{
+			if ( !pending.empty() )
+				pending += ( pending.find( "Hex-STRING: " ) != std::string::npos ? " " : "\n" ) + line;
+			continue;
+		}
+
+		flush();
+		pending = line;
+	}
+	flush();
+
+	LOG(Log::INF, LogComponentLevels::mule()) << "Device image loaded " << loaded << " OIDs, skipped " << skipped;
+
+	return loaded;
+
+}
+
+bool SnmpDeviceImage::parseValue( const std::string& type, const std::string& text, Value& value ) const
+{
+
+	long long number = 0;
+
+	if ( type == "STRING" )
+	{
+		if ( isOpenString( text ) )
+			return false;
+		value.type = ASN_OCTET_STR;
+		value.data = unquote( text );
+		return true;
+	}
+	if ( type == "Hex-STRING" || type == "BITS" )
+	{
+		value.type = ASN_OCTET_STR;
+		value.data = parseHex( text );
+		return true;
+	}
+	if ( type == "INTEGER" && parseNumber( text, number, false ) )
+	{
+		value.type = ASN_INTEGER;
+		value.data = fromLong( static_cast<long>(number) );
+		return true;
+	}
+	if ( ( type == "Counter32" || type == "Gauge32" || type == "UInteger32" || type == "Unsigned32" || type == "Timeticks" )
+			&& parseNumber( text, number, true ) )
+	{
+		value.type = type == "Counter32" ? ASN_COUNTER : type == "Timeticks" ? ASN_TIMETICKS : ASN_GAUGE;
+		value.data = fromLong( static_cast<long>(number & 0xFFFFFFFF) );
+		return true;
+	}
+	if ( type == "Counter64" && parseNumber( text, number, true ) )
+	{
+		const unsigned long long counter = static_cast<unsigned long long>(number);
+		struct counter64 value64;
+		value64.high = counter >> 32;
+		value64.low = counter & 0xFFFFFFFF;
+		value.type = ASN_COUNTER64;
+		value.data = std::string( reinterpret_cast<const char*>(&value64), sizeof value64 );
+		return true;
+	}
+	if ( type == "OID" )
+	{
+		const Oid objectId( text );
+		value.type = ASN_OBJECT_ID;
+		value.data = std::string( reinterpret_cast<const char*>(objectId.data()), objectId.size() * sizeof(oid) );
+		return true;
+	}
+	if ( type == "IpAddress" || type == "Network Address" )
+	{
+		in_addr address;
+		if ( inet_pton( AF_INET, text.c_str(), &address ) != 1 )
+			return false;
+		value.type = ASN_IPADDRESS;
+		value.data = std::string( reinterpret_cast<const char*>(&address), 4 );
+		return true;
+	}
+
+	// Opaque, NULL, "No Such Object available on this agent at this OID", ...
+	return false;
+
+}
+
+void SnmpDeviceImage::set( const Oid& name, u_char type, const void * value, size_t length )
+{
+
+	m_values[name] = Value{ type, std::string( static_cast<const char*>(value), length ) };
+
+}
+
+void SnmpDeviceImage::setInteger( const Oid& name, long value, u_char type )
+{
+
+	set( name, type, &value, sizeof value );
+
+}
+
+void SnmpDeviceImage::setString( const Oid& name, const std::string& value )
+{
+
+	set( name, ASN_OCTET_STR, value.data(), value.size() );
+
+}
+
+const SnmpDeviceImage::Value * SnmpDeviceImage::find( const Oid& name ) const
+{
+
+	const auto value = m_values.find( name );
+	return value == m_values.end() ? nullptr : &value->second;
+
+}
+
+} // Snmp
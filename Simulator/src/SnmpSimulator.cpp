@@ -0,0 +1,518 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <SnmpSimulator.h>
+#include <SnmpLibrary.h>
+#include <SnmpExceptions.h>
+#include <MuleLogComponents.h>
+
+#include <cerrno>
+#include <limits>
+
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+using Mule::LogComponentLevels;
+
+namespace Snmp
+{
+
+namespace
+{
+
+size_t countVarbinds( const netsnmp_pdu * pdu )
+{
+	size_t count = 0;
+	for ( const netsnmp_variable_list * vars = pdu->variables; vars; vars = vars->next_variable )
+		count++;
+	return count;
+}
+
+void addException( netsnmp_pdu * response, const Oid& name, u_char type )
+{
+	snmp_pdu_add_variable( response, name.data(), name.size(), type, nullptr, 0 );
+}
+
+}
+
+SnmpSimulator::SnmpSimulator( unsigned int seed ) :
+				m_devicesChanged(false),
+				m_random(seed),
+				m_requests(0),
+				m_responses(0),
+				m_dropped(0),
+				m_running(true)
+{
+
+	SnmpLibrary::initialize();
+
+	if ( pipe(m_wakeUpPipe) != 0 )
+		snmp_throw_runtime_error_with_origin("Failed to create the wake up pipe of the simulator");
+
+	fcntl( m_wakeUpPipe[0], F_SETFL, O_NONBLOCK );
+	fcntl( m_wakeUpPipe[1], F_SETFL, O_NONBLOCK );
+
+	m_thread = std::thread( &SnmpSimulator::eventLoop, this );
+
+}
+
+SnmpSimulator::~SnmpSimulator()
+{
+
+	m_running = false;
+	wakeUp();
+	m_thread.join();
+
+	while ( !m_delayed.empty() )
+	{
+		snmp_free_pdu( m_delayed.top().response );
+		m_delayed.pop();
+	}
+
+	for ( auto& device : m_devices )
+		snmp_sess_close( device->sessp );
+
+	close( m_wakeUpPipe[0] );
+	close( m_wakeUpPipe[1] );
+
+}
+
+uint16_t SnmpSimulator::addDevice( std::shared_ptr<const SnmpDeviceImage> image, const SnmpSimulatedDeviceOptions& options )
+{
+
+	const std::string endpoint = "udp:" + options.address + ":" + std::to_string( options.port );
+
+	netsnmp_transport * transport = netsnmp_transport_open_server( "snmp", endpoint.c_str() );
+	if ( !transport )
+		snmp_throw_runtime_error_with_origin("Failed to open simulated device on " + endpoint);
+
+	std::unique_ptr<Device> device( new Device{ this, std::move(image), {}, options, nullptr, options.port } );
+
+	sockaddr_in local;
+	socklen_t localLength = sizeof local;
+	if ( getsockname( transport->sock, reinterpret_cast<sockaddr*>(&local), &localLength ) == 0 && local.sin_family == AF_INET )
+		device->port = ntohs( local.sin_port );
+
+	snmp_session session;
+	snmp_sess_init( &session );
+	session.callback = &SnmpSimulator::requestCallback;
+	session.callback_magic = device.get();
+	session.isAuthoritative = SNMP_SESS_AUTHORITATIVE;
+
+	// Owns the transport from now on, also on failure
+	device->sessp = snmp_sess_add( &session, transport, nullptr, nullptr );
+	if ( !device->sessp )
+		snmp_throw_runtime_error_with_origin("Failed to open simulated device session on " + endpoint);
+
+	const uint16_t port = device->port;
+	{
+		std::lock_guard<std::mutex> guard(m_devicesMutex);
+		m_devices.push_back( std::move(device) );
+		m_devicesChanged = true;
+	}
+	wakeUp();
+
+	LOG(Log::DBG, LogComponentLevels::mule()) << "Simulated device on " << options.address << ":" << port;
+
+	return port;
+
+}
+
+size_t SnmpSimulator::deviceCount() const
+{
+
+	std::lock_guard<std::mutex> guard(m_devicesMutex);
+	return m_devices.size();
+
+}
+
+SnmpSimulator::Statistics SnmpSimulator::getStatistics() const
+{
+
+	Statistics statistics;
+	statistics.requests = m_requests;
+	statistics.responses = m_responses;
+	statistics.dropped = m_dropped;
+	return statistics;
+
+}
+
+void SnmpSimulator::wakeUp()
+{
+
+	const char byte = 0;
+	// A full pipe already guarantees a wake up, nothing to do on failure
+	if ( write( m_wakeUpPipe[1], &byte, 1 ) < 0 ) {}
+
+}
+
+void SnmpSimulator::eventLoop()
+{
+
+	std::vector<pollfd> pollFds;
+	std::vector<Device*> pollDevices;
+
+	while ( m_running )
+	{
+
+		{
+			std::lock_guard<std::mutex> guard(m_devicesMutex);
+			if ( m_devicesChanged || pollFds.empty() )
+			{
+				pollFds.assign( 1, pollfd{ m_wakeUpPipe[0], POLLIN, 0 } );
+				pollDevices.assign( 1, nullptr );
+				for ( auto& device : m_devices )
+				{
+					pollFds.push_back( pollfd{ snmp_sess_transport( device->sessp )->sock, POLLIN, 0 } );
+					pollDevices.push_back( device.get() );
+				}
+				m_devicesChanged = false;
+			}
+		}
+
+		// Sleep until the next delayed response at most
+		timespec timeout;
+		timespec * timeoutPointer = nullptr;
+		if ( !m_delayed.empty() )
+		{
+			const auto wait = std::max( std::chrono::steady_clock::duration::zero(), m_delayed.top().due - std::chrono::steady_clock::now() );
+			const auto waitNs = std::chrono::duration_cast<std::chrono::nanoseconds>( wait ).count();
+			timeout.tv_sec = waitNs / 1000000000;
+			timeout.tv_nsec = waitNs % 1000000000;
+			timeoutPointer = &timeout;
+		}
+
+		if ( ppoll( pollFds.data(), pollFds.size(), timeoutPointer, nullptr ) < 0 && errno != EINTR )
+		{
+			LOG(Log::ERR, LogComponentLevels::mule()) << "Simulator poll failed, errno: " << errno;
+			std::this_thread::sleep_for( std::chrono::milliseconds(10) );
+			continue;
+		}
+
+		if ( pollFds[0].revents & POLLIN )
+		{
+			char buffer[64];
+			while ( read( m_wakeUpPipe[0], buffer, sizeof buffer ) > 0 ) {}
+		}
+
+		for ( size_t i = 1; i < pollFds.size(); i++ )
+		{
+			if ( !(pollFds[i].revents & (POLLIN | POLLERR)) )
+				continue;
+
+			netsnmp_large_fd_set readFds;
+			netsnmp_large_fd_set_init( &readFds, pollFds[i].fd + 1 );
+			NETSNMP_LARGE_FD_SET( pollFds[i].fd, &readFds );
+			snmp_sess_read2( pollDevices[i]->sessp, &readFds );
+			netsnmp_large_fd_set_cleanup( &readFds );
+		}
+
+		sendDueResponses();
+
+	}
+
+}
+
+void SnmpSimulator::sendDueResponses()
+{
+
+	const auto now = std::chrono::steady_clock::now();
+	while ( !m_delayed.empty() && m_delayed.top().due <= now )
+	{
+		send( m_delayed.top().sessp, m_delayed.top().response );
+		m_delayed.pop();
+	}
+
+}
+
+void SnmpSimulator::send( void * sessp, netsnmp_pdu * response )
+{
+
+	if ( snmp_sess_send( sessp, response ) == 0 )
+	{
+		snmp_free_pdu( response );
+		return;
+	}
+	m_responses++;
+
+}
+
+int SnmpSimulator::requestCallback( int operation, netsnmp_session * /*session*/, int /*reqid*/, netsnmp_pdu *pdu, void *magic )
+{
+
+	if ( operation == NETSNMP_CALLBACK_OP_RECEIVED_MESSAGE )
+	{
+		Device * device = static_cast<Device*>( magic );
+		device->simulator->processRequest( *device, pdu );
+	}
+
+	// The library frees the request once we return
+	return 1;
+
+}
+
+void SnmpSimulator::processRequest( Device& device, netsnmp_pdu * request )
+{
+
+	m_requests++;
+
+	if ( device.options.lossProbability > 0 && std::uniform_real_distribution<double>( 0.0, 1.0 )( m_random ) < device.options.lossProbability )
+	{
+		m_dropped++;
+		return;
+	}
+
+	netsnmp_pdu * response = answer( device, request );
+	if ( !response )
+	{
+		m_dropped++;
+		return;
+	}
+
+	int delayUs = device.options.latencyUs;
+	if ( device.options.jitterUs > 0 )
+		delayUs += std::uniform_int_distribution<int>( 0, device.options.jitterUs )( m_random );
+
+	if ( delayUs <= 0 )
+		send( device.sessp, response );
+	else
+		m_delayed.push( DelayedResponse{ std::chrono::steady_clock::now() + std::chrono::microseconds(delayUs), device.sessp, response } );
+
+}
+
+netsnmp_pdu * SnmpSimulator::answer( Device& device, netsnmp_pdu * request )
+{
+
+	// Agents ignore requests with a community they do not know
+	const std::string community( reinterpret_cast<const char*>(request->community), request->community_len );
+	if ( request->version == SNMP_VERSION_3 || community != device.options.community )
+		return nullptr;
+
+	// Same request id, version, community and return address
+	netsnmp_pdu * response = snmp_clone_pdu( request );
+	if ( !response )
+		return nullptr;
+
+	snmp_free_varbind( response->variables );
+	response->variables = nullptr;
+	response->command = SNMP_MSG_RESPONSE;
+	response->errstat = SNMP_ERR_NOERROR;
+	response->errindex = 0;
+
+	switch ( request->command )
+	{
+		case SNMP_MSG_GET:
+			answerGet( device, request, response );
+			break;
+		case SNMP_MSG_GETNEXT:
+			answerGetNext( device, request, response );
+			break;
+		case SNMP_MSG_GETBULK:
+			answerGetBulk( device, request, response );
+			break;
+		case SNMP_MSG_SET:
+			answerSet( device, request, response );
+			break;
+		default:
+			snmp_free_pdu( response );
+			return nullptr;
+	}
+
+	return response;
+
+}
+
+void SnmpSimulator::answerGet( Device& device, netsnmp_pdu * request, netsnmp_pdu * response )
+{
+
+	if ( device.options.maxVarbinds && countVarbinds( request ) > device.options.maxVarbinds )
+		return setError( request, response, SNMP_ERR_TOOBIG, 0 );
+
+	Oid name;
+	long index = 1;
+	for ( netsnmp_variable_list * vars = request->variables; vars; vars = vars->next_variable, index++ )
+	{
+		name.assign( vars->name, vars->name_length );
+		const SnmpDeviceImage::Value * value = find( device, name );
+		if ( value )
+			addValue( response, name, *value );
+		else if ( request->version == SNMP_VERSION_1 )
+			return setError( request, response, SNMP_ERR_NOSUCHNAME, index );
+		else
+			addException( response, name, SNMP_NOSUCHOBJECT );
+	}
+
+}
+
+void SnmpSimulator::answerGetNext( Device& device, netsnmp_pdu * request, netsnmp_pdu * response )
+{
+
+	if ( device.options.maxVarbinds && countVarbinds( request ) > device.options.maxVarbinds )
+		return setError( request, response, SNMP_ERR_TOOBIG, 0 );
+
+	Oid name;
+	long index = 1;
+	for ( netsnmp_variable_list * vars = request->variables; vars; vars = vars->next_variable, index++ )
+	{
+		name.assign( vars->name, vars->name_length );
+		const auto next = device.image->next( name );
+		if ( next != device.image->end() )
+			addValue( response, next->first, *find( device, next->first ) );
+		else if ( request->version == SNMP_VERSION_1 )
+			return setError( request, response, SNMP_ERR_NOSUCHNAME, index );
+		else
+			addException( response, name, SNMP_ENDOFMIBVIEW );
+	}
+
+}
+
+void SnmpSimulator::answerGetBulk( Device& device, netsnmp_pdu * request, netsnmp_pdu * response )
+{
+
+	// Read before the response fields they alias are used
+	const long nonRepeaters = std::max( 0L, static_cast<long>( request->non_repeaters ) );
+	const long maxRepetitions = std::max( 0L, static_cast<long>( request->max_repetitions ) );
+
+	// Responses are truncated to what fits, rather than refused
+	const size_t limit = device.options.maxVarbinds ? device.options.maxVarbinds : std::numeric_limits<size_t>::max();
+	size_t added = 0;
+
+	std::vector<Oid> repeaters;
+	Oid name;
+	long index = 0;
+	for ( netsnmp_variable_list * vars = request->variables; vars; vars = vars->next_variable, index++ )
+	{
+		name.assign( vars->name, vars->name_length );
+		if ( index >= nonRepeaters )
+		{
+			repeaters.push_back( name );
+			continue;
+		}
+		if ( added++ >= limit )
+			return;
+		const auto next = device.image->next( name );
+		if ( next != device.image->end() )
+			addValue( response, next->first, *find( device, next->first ) );
+		else
+			addException( response, name, SNMP_ENDOFMIBVIEW );
+	}
+
+	for ( long repetition = 0; repetition < maxRepetitions && !repeaters.empty(); repetition++ )
+	{
+		bool ended = true;
+		for ( auto& repeater : repeaters )
+		{
+			if ( added++ >= limit )
+				return;
+			const auto next = device.image->next( repeater );
+			if ( next != device.image->end() )
+			{
+				addValue( response, next->first, *find( device, next->first ) );
+				repeater = next->first;
+				ended = false;
+			}
+			else
+				addException( response, repeater, SNMP_ENDOFMIBVIEW );
+		}
+		// Every column is at the end of the MIB view, more rows would say the same
+		if ( ended )
+			return;
+	}
+
+}
+
+void SnmpSimulator::answerSet( Device& device, netsnmp_pdu * request, netsnmp_pdu * response )
+{
+
+	const bool v1 = request->version == SNMP_VERSION_1;
+
+	if ( device.options.maxVarbinds && countVarbinds( request ) > device.options.maxVarbinds )
+		return setError( request, response, SNMP_ERR_TOOBIG, 0 );
+
+	if ( !device.options.writable )
+		return setError( request, response, v1 ? SNMP_ERR_NOSUCHNAME : SNMP_ERR_NOTWRITABLE, 1 );
+
+	// All or nothing: every varbind is checked before any is written
+	Oid name;
+	long index = 1;
+	for ( netsnmp_variable_list * vars = request->variables; vars; vars = vars->next_variable, index++ )
+	{
+		name.assign( vars->name, vars->name_length );
+		const SnmpDeviceImage::Value * value = find( device, name );
+		if ( !value )
+			return setError( request, response, v1 ? SNMP_ERR_NOSUCHNAME : SNMP_ERR_NOCREATION, index );
+		if ( value->type != vars->type )
+			return setError( request, response, v1 ? SNMP_ERR_BADVALUE : SNMP_ERR_WRONGTYPE, index );
+	}
+
+	for ( netsnmp_variable_list * vars = request->variables; vars; vars = vars->next_variable )
+	{
+		name.assign( vars->name, vars->name_length );
+		device.written[name] = SnmpDeviceImage::Value{ vars->type, std::string( reinterpret_cast<const char*>(vars->val.string), vars->val_len ) };
+	}
+
+	response->variables = snmp_clone_varbind( request->variables );
+
+}
+
+void SnmpSimulator::setError( netsnmp_pdu * request, netsnmp_pdu * response, long errorStatus, long errorIndex )
+{
+
+	snmp_free_varbind( response->variables );
+
+	// Error responses echo the request, except SNMPv2 tooBig which has no varbinds (RFC 3416)
+	const bool echo = errorStatus != SNMP_ERR_TOOBIG || request->version == SNMP_VERSION_1;
+	response->variables = echo ? snmp_clone_varbind( request->variables ) : nullptr;
+	response->errstat = errorStatus;
+	response->errindex = errorIndex;
+
+}
+
+const SnmpDeviceImage::Value * SnmpSimulator::find( const Device& device, const Oid& name ) const
+{
+
+	const auto written = device.written.find( name );
+	if ( written != device.written.end() )
+		return &written->second;
+	return device.image->find( name );
+
+}
+
+void SnmpSimulator::addValue( netsnmp_pdu * response, const Oid& name, const SnmpDeviceImage::Value& value )
+{
+
+	snmp_pdu_add_variable( response, name.data(), name.size(), value.type, value.data.data(), value.data.size() );
+
+}
+
+} // Snmp
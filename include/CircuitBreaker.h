@@ -0,0 +1,112 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <mutex>
+#include <chrono>
+#include <functional>
+
+#include <SnmpDefinitions.h>
+
+namespace Snmp
+{
+
+struct CircuitBreakerOptions
+{
+	// consecutive requests without answer which open the circuit
+	unsigned failureThreshold = Snmp::Constants::SNMP_CIRCUIT_FAILURE_THRESHOLD;
+	// time open before the first probe, in us, doubled after every failed probe
+	int openDurationUs = Snmp::Constants::SNMP_CIRCUIT_OPEN_DURATION;
+	// bound of the doubling, in us
+	int maxOpenDurationUs = Snmp::Constants::SNMP_CIRCUIT_MAX_OPEN_DURATION;
+};
+
+/**
+ * Health of one device. Closed lets every request through. After failureThreshold requests in a
+ * row without answer it opens and refuses requests without any I/O. Once the open duration is
+ * over, it goes half-open and lets a single probe through: an answer closes it, a failure opens
+ * it again for twice as long.
+ *
+ * Only transport failures count (timeouts, send errors), an agent answering with an error is alive.
+ *
+ * Thread safe. The listener is called outside of the lock, on the thread making the transition.
+ */
+class CircuitBreaker
+{
+
+public:
+	enum class State
+	{
+		Closed,
+		Open,
+		HalfOpen
+	};
+
+	typedef std::function<void(State from, State to)> StateListener;
+
+	explicit CircuitBreaker( const CircuitBreakerOptions& options = CircuitBreakerOptions(), StateListener listener = nullptr );
+
+	/**
+	 * To call before sending a request. In half-open state the caller allowed in is the probe.
+	 * @return false when the request must fail without I/O
+	 */
+	bool allowRequest();
+
+	/**
+	 * Same answer as allowRequest() without becoming the probe, for callers which check early
+	 */
+	bool isRejecting() const;
+
+	void onSuccess();
+	void onFailure();
+
+	State getState() const;
+
+	static const char * stateToString( State state );
+
+private:
+	typedef std::chrono::steady_clock Clock;
+
+	void setState( State state, std::unique_lock<std::mutex>& guard );
+
+	const CircuitBreakerOptions m_options;
+	const StateListener m_listener;
+
+	mutable std::mutex m_mutex;
+	State m_state;
+	unsigned m_consecutiveFailures;
+	std::chrono::microseconds m_openDuration;
+	Clock::time_point m_probeTime;
+	bool m_probeInFlight;
+
+};
+
+} // Snmp
@@ -31,34 +31,82 @@
 #pragma once
 
 #include <string>
+#include <ostream>
 #include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
 
 namespace Snmp
 {
 
+/**
+ * Object identifier kept as native sub-identifiers, the form net-snmp works with. Up to
+ * INLINE_CAPACITY sub-identifiers are stored in the object itself, longer OIDs use the heap.
+ */
 class Oid
 {
 public:
+	static const size_t INLINE_CAPACITY = 20;
+
+	Oid() : m_oidSize(0) {};
 	explicit Oid( const std::string& oidOfInterest );
+	Oid( const oid * subIdentifiers, size_t length );
 	virtual ~Oid() = default;
 
 private:
 
 	friend class SnmpBackend;
 
-	std::string m_originalString;
-	std::vector<std::string> m_oidVector;
+	oid m_inline[INLINE_CAPACITY];
+	std::vector<oid> m_overflow;
 	uint32_t m_oidSize;
-	void assign( std::string );
+	void assign( const std::string& );
+	oid * reserve( size_t length );
 
 public:
 
-	const std::string& getOidString() const { return m_originalString; };
-	const std::vector<std::string>& getOidVector() const { return m_oidVector; };
-	void printOidFromVector();
-	uint32_t getOidSize() { return m_oidSize; };
+	/**
+	 * Dotted numeric form without leading dot, e.g. 1.3.6.1.2.1.1.1.0, whatever the form the
+	 * OID was given in: SNMPv2-MIB::sysDescr.0 and .1.3.6.1.2.1.1.1.0 print like that as well.
+	 * Built on each call, the text given at construction is not kept.
+	 */
+	std::string getOidString() const;
+	std::vector<std::string> getOidVector() const;
+	void printOidFromVector() const;
+	uint32_t getOidSize() const { return m_oidSize; };
 	Oid& operator()( const std::string& );
 
+	const oid * data() const { return m_oidSize <= INLINE_CAPACITY ? m_inline : m_overflow.data(); };
+	size_t size() const { return m_oidSize; };
+	bool empty() const { return m_oidSize == 0; };
+	oid operator[]( size_t position ) const { return data()[position]; };
+
+	Oid& assign( const oid * subIdentifiers, size_t length );
+	Oid& append( oid subIdentifier );
+	Oid& append( const Oid& suffix );
+
+	/**
+	 * @return true if this OID equals the first sub-identifiers of other, e.g. a table column
+	 * OID is a prefix of the OIDs of its cells
+	 */
+	bool isPrefixOf( const Oid& other ) const;
+
+	/**
+	 * Lexicographic comparison, the order of a walk
+	 * @return negative, zero or positive when this OID sorts before, equal or after other
+	 */
+	int compare( const Oid& other ) const;
+
+	bool operator==( const Oid& other ) const { return compare(other) == 0; };
+	bool operator!=( const Oid& other ) const { return compare(other) != 0; };
+	bool operator<( const Oid& other ) const { return compare(other) < 0; };
+	bool operator>( const Oid& other ) const { return compare(other) > 0; };
+
 };
 
-} // Snmp
\ No newline at end of file
+std::ostream& operator<<( std::ostream& stream, const Oid& oidOfInterest );
+
+} // Snmp
@@ -0,0 +1,91 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <mutex>
+#include <cstdint>
+
+#include <SnmpDefinitions.h>
+
+namespace Snmp
+{
+
+struct RttEstimatorOptions
+{
+	// lowest timeout ever used, in us, guards against spurious retransmissions
+	int floorUs = Snmp::Constants::SNMP_RTT_FLOOR;
+	// highest timeout ever used, in us, also bounds the backoff
+	int ceilingUs = Snmp::Constants::SNMP_RTT_CEILING;
+};
+
+/**
+ * Round trip time estimation of one device, as TCP does it (RFC 6298): smoothed RTT and RTT
+ * variation give the retransmission timeout, doubled on every timeout until a new sample comes.
+ * Callers follow Karn's rule: responses to retransmitted requests are not sampled.
+ *
+ * Thread safe.
+ */
+class RttEstimator
+{
+
+public:
+	struct Estimate
+	{
+		int64_t smoothedRttUs = 0;
+		int64_t rttVariationUs = 0;
+		// timeout of the next request
+		int64_t timeoutUs = 0;
+		uint64_t samples = 0;
+		uint64_t timeouts = 0;
+	};
+
+	/**
+	 * @param initialTimeoutUs timeout until the first sample
+	 */
+	RttEstimator( int initialTimeoutUs, const RttEstimatorOptions& options = RttEstimatorOptions() );
+
+	void addSample( int64_t rttUs );
+	void onTimeout();
+
+	int timeoutUs() const;
+	Estimate getEstimate() const;
+
+private:
+	int64_t clamp( int64_t timeoutUs ) const;
+
+	const RttEstimatorOptions m_options;
+
+	mutable std::mutex m_mutex;
+	Estimate m_estimate;
+
+};
+
+} // Snmp
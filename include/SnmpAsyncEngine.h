@@ -0,0 +1,142 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <unordered_map>
+#include <mutex>
+#include <thread>
+#include <future>
+#include <atomic>
+#include <chrono>
+#include <functional>
+
+#include <SnmpBackend.h>
+#include <SnmpStatus.h>
+#include <SnmpDefinitions.h>
+
+namespace Snmp
+{
+
+/**
+ * Event loop sending requests without blocking the caller, so that many PDUs can be in flight
+ * towards many devices at once. Every backend used with the engine gets a dedicated session,
+ * opened with the backend's settings and only ever touched by the loop thread.
+ *
+ * Callbacks are invoked on the loop thread and must not block.
+ */
+class SnmpAsyncEngine
+{
+
+public:
+	typedef std::function<void(SnmpStatus, PduPtr)> Callback;
+
+	SnmpAsyncEngine();
+	~SnmpAsyncEngine();
+
+	// CppCoreGuidelines C.21
+	SnmpAsyncEngine(const SnmpAsyncEngine&) = delete;
+	SnmpAsyncEngine& operator=(const SnmpAsyncEngine&) = delete;
+	SnmpAsyncEngine(SnmpAsyncEngine&&) = delete;
+	SnmpAsyncEngine& operator=(SnmpAsyncEngine&&) = delete;
+
+	/**
+	 * Sends any request PDU to the device of the backend.
+	 * @param backend device to talk to, must outlive the engine or be detached
+	 * @param pdu request, owned by the engine from now on
+	 * @param callback invoked once with the response, or with Snmp_BadTimeout when no response
+	 * arrived within timeoutUs, or with Snmp_BadCommunicationError when the request could not be sent
+	 * @param timeoutUs deadline of this request, independent from the session retries
+	 */
+	void asyncSend( SnmpBackend& backend, PduPtr pdu, Callback callback, int timeoutUs = Snmp::Constants::SNMP_TIMEOUT );
+
+	void asyncGet( SnmpBackend& backend, const std::vector<std::string>& oidsOfInterest, Callback callback, int timeoutUs = Snmp::Constants::SNMP_TIMEOUT );
+	std::future<std::pair<SnmpStatus, PduPtr>> asyncGet( SnmpBackend& backend, const std::vector<std::string>& oidsOfInterest, int timeoutUs = Snmp::Constants::SNMP_TIMEOUT );
+
+	/**
+	 * Closes the session of the backend. Its pending requests complete with Snmp_BadCommunicationError.
+	 * Returns once done, so that the backend can be destroyed afterwards.
+	 * Called from a callback, the session is closed before returning as well.
+	 */
+	void detach( SnmpBackend& backend );
+
+	size_t pendingRequests() const { return m_pendingCount; };
+
+private:
+
+	struct Submission
+	{
+		SnmpBackend* backend;
+		PduPtr pdu;
+		Callback callback;
+		int timeoutUs;
+	};
+
+	struct PendingRequest
+	{
+		void * sessp;
+		Callback callback;
+		std::chrono::steady_clock::time_point deadline;
+	};
+
+	void eventLoop();
+	void wakeUp();
+	void processSubmissions();
+	void processDetachRequests();
+	void detachSession( SnmpBackend* backend );
+	void expireRequests();
+	void completeRequest( int reqid, SnmpStatus status, PduPtr response );
+	static void invokeCallback( Callback& callback, SnmpStatus status, PduPtr response );
+	void failSession( void * sessp );
+	void * sessionFor( SnmpBackend& backend );
+
+	static int responseCallback( int operation, netsnmp_session *session, int reqid, netsnmp_pdu *pdu, void *magic );
+
+	std::mutex m_submissionMutex;
+	std::deque<Submission> m_submissions;
+	std::deque<std::pair<SnmpBackend*, std::promise<void>>> m_detachRequests;
+
+	// Touched by the loop thread only
+	std::map<SnmpBackend*, void*> m_sessions;
+	std::unordered_map<int, PendingRequest> m_pending;
+	std::vector<void*> m_closedSessions;
+
+	std::atomic<size_t> m_pendingCount;
+	std::atomic<bool> m_running;
+	int m_wakeUpPipe[2];
+	std::thread m_thread;
+
+};
+
+} // Snmp
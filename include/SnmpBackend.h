@@ -36,6 +36,9 @@
 #include <mutex>
 #include <memory>
 #include <functional>
+#include <string_view>
+#include <atomic>
+#include <algorithm>
 
 #include <net-snmp/net-snmp-config.h>
 #include <net-snmp/net-snmp-includes.h>
@@ -43,6 +46,13 @@
 #include <Oid.h>
 #include <SnmpStatus.h>
 #include <SnmpDefinitions.h>
+#include <SnmpSessionPool.h>
+#include <SnmpTypeTraits.h>
+#include <RttEstimator.h>
+#include <CircuitBreaker.h>
+#include <SnmpMetrics.h>
+#include <SnmpResult.h>
+#include <SnmpTracer.h>
 
 namespace Snmp{
 
@@ -51,12 +61,39 @@ typedef std::variant<
 					int32_t,
 					// ASN.1 OCTET STRING
 					std::string,
-					// SMIv2 Counter32/Gauge32/TimeTicks/Unsigned32
+					// SMIv2 Gauge32/Unsigned32
 					uint32_t,
 					// mule bool
-					bool>
+					bool,
+					// SMIv2 Counter64
+					uint64_t,
+					// SMIv2 TimeTicks
+					TimeTicks,
+					// SMIv2 IpAddress
+					IpAddress,
+					// Opaque float and double of net-snmp
+					float,
+					double>
 					snmpSetValue;
 
+typedef std::variant<
+					// no value, see the accompanying SnmpStatus
+					std::monostate,
+					// ASN.1 INTEGER, SMIv2 Integer32
+					int32_t,
+					// ASN.1 OCTET STRING
+					std::string,
+					// SMIv2 Counter32/Gauge32/TimeTicks/Unsigned32
+					uint32_t,
+					// SMIv2 Counter64
+					uint64_t,
+					// SMIv2 IpAddress
+					IpAddress,
+					// Opaque float and double of net-snmp
+					float,
+					double>
+					snmpGetValue;
+
 struct PduDeleter
 {
 	void operator()(netsnmp_pdu* p)
@@ -66,6 +103,45 @@ struct PduDeleter
 };
 typedef std::unique_ptr<netsnmp_pdu, PduDeleter> PduPtr;
 
+/**
+ * Conceptual table, column-major: values[column][row], columns in the order they were requested
+ * and rows sorted by index. A row absent from a column (sparse table) has Snmp_BadNoDataAvailable
+ * in that column.
+ */
+struct SnmpTable
+{
+	// column sub-identifiers below the table entry, as requested
+	std::vector<oid> columns;
+	// INDEX part of the OIDs of the rows present in any column, e.g. the ifIndex of ifTable rows
+	std::vector<Oid> rowIndices;
+	std::vector<std::vector<std::pair<SnmpStatus, snmpGetValue>>> values;
+
+	size_t rowCount() const { return rowIndices.size(); };
+
+	/**
+	 * @return position of the row in rowIndices, rowCount() when absent
+	 */
+	size_t findRow( const Oid& rowIndex ) const
+	{
+		const auto row = std::lower_bound( rowIndices.begin(), rowIndices.end(), rowIndex );
+		return ( row != rowIndices.end() && *row == rowIndex ) ? row - rowIndices.begin() : rowIndices.size();
+	}
+
+	/**
+	 * @return the cell as T, Snmp_BadNoDataAvailable when missing or of another type
+	 */
+	template <typename T>
+	std::pair<SnmpStatus, T> get( size_t column, size_t row ) const
+	{
+		const auto& cell = values[column][row];
+		if ( cell.first != Snmp_Good )
+			return std::pair<SnmpStatus, T>(cell.first, T{});
+		if ( const T * value = std::get_if<T>( &cell.second ) )
+			return std::pair<SnmpStatus, T>(Snmp_Good, *value);
+		return std::pair<SnmpStatus, T>(Snmp_BadNoDataAvailable, T{});
+	}
+};
+
 class SnmpBackend {
 
 public:
@@ -97,6 +173,8 @@ public:
     SnmpBackend& operator=(SnmpBackend&&) = default;
 
 private:
+	friend class SnmpAsyncEngine;
+
 	snmp_session createSessionV2 ();
 	snmp_session createSessionV3 ();
 	void openSession ( snmp_session snmpSession );
@@ -115,26 +193,217 @@ private:
 	const int m_snmpMaxRetries;
 	const int m_snmpTimeoutUs;
 
-	void * m_sessp;
+	SnmpSessionPool m_sessionPool;
 	snmp_session m_snmpSession;
 	netsnmp_session * m_snmpSessionHandle;
 
 	SnmpStatus throwIfSnmpResponseError ( int status, netsnmp_pdu *response );
-	std::vector<oid> prepareOid ( const std::string& oidOfInterest );
+	SnmpError responseError ( int status, const netsnmp_pdu *response ) const;
+	static SnmpError varbindError ( const netsnmp_variable_list * vars );
+	bool tryPrepareOid ( const std::string& oidOfInterest, Oid& prepared, SnmpError& error );
+	Oid prepareOid ( const std::string& oidOfInterest );
 	int securityLevelToInt ( const std::string & securityLevel );
 	std::pair<oid*, size_t> securityProtocolToOidDetails( const std::string & protocol );
 	std::string oidToString(const oid * objid, size_t objidlen, const netsnmp_variable_list * variable);
 	std::pair<SnmpStatus, unsigned char > translateIntToBoolean ( int32_t rawValue );
+	static void logUnexpectedType ( const netsnmp_variable_list * vars, const Oid& oidOfInterest );
+
+	int synchResponse ( netsnmp_pdu *pdu, netsnmp_pdu **response );
+	int adaptiveSynchResponse ( void * sessp, netsnmp_pdu *pdu, netsnmp_pdu **response );
+	typedef std::function<bool(const Oid&, const netsnmp_variable_list *)> VarbindVisitor;
+	void walkVarbinds ( const Oid& seedOid, long maxRepetitions, const VarbindVisitor& visit );
+	PduPtr walkRequest ( const Oid& oidOfInterest, long maxRepetitions );
+	void snmpGetPending ( const std::vector<Oid>& subIdentifierLists,
+				const std::vector<size_t>& pending,
+				std::vector<std::pair<SnmpStatus, snmpGetValue>>& results );
+	bool snmpGetBatch ( const std::vector<Oid>& subIdentifierLists,
+				const std::vector<size_t>& indices,
+				std::vector<std::pair<SnmpStatus, snmpGetValue>>& results );
+	bool snmpSetBatch ( const std::vector<std::pair<Oid, snmpSetValue>>& varbinds,
+				const std::vector<size_t>& indices,
+				bool atomic,
+				std::vector<SnmpError>& results );
+
+	/*
+	 *	Upper bound of varbinds packed in one GET PDU. Lowered whenever the agent answers tooBig,
+	 *	so that later calls do not hit the same limit again.
+	 */
+	std::atomic<size_t> m_maxVarbindsPerPdu;
+
+	// Same for SET PDUs, whose requests carry the values and hit tooBig long before GETs do
+	std::atomic<size_t> m_maxSetVarbindsPerPdu;
+
+	// Set when timeouts follow the measured round trip times instead of m_snmpTimeoutUs
+	std::unique_ptr<RttEstimator> m_rttEstimator;
+
+	// Set when requests to a device known to be down fail fast
+	std::unique_ptr<CircuitBreaker> m_circuitBreaker;
+	bool isCircuitOpen() const { return m_circuitBreaker && m_circuitBreaker->isRejecting(); };
 
-	std::mutex m_mutex;
+	SnmpMetrics m_metrics;
+
+	// this device in SnmpTracer dumps, registered on the first traced request
+	std::atomic<uint32_t> m_traceDevice;
+	uint32_t traceDevice();
 
 public:
+	/**
+	 * Decodes a varbind into the type its ASN.1 tag maps to
+	 * @return Snmp_BadNoDataAvailable for exception values, Snmp_BadNotSupported for other types
+	 */
+	static std::pair<SnmpStatus, snmpGetValue> decodeVariable ( const netsnmp_variable_list * vars );
+
+	/**
+	 * Adds a SET varbind carrying the value, encoded with the ASN.1 type of its alternative
+	 * @return Snmp_BadNotSupported when the value cannot be encoded, nothing is added then
+	 */
+	static SnmpStatus addSetVarbind ( netsnmp_pdu * pdu, const Oid& oidOfInterest, const snmpSetValue& value );
+
+	/**
+	 * End criteria of snmpDeviceWalk: end of MIB view, or nextDeviceOid not on the level of currentDeviceOid
+	 */
+	static bool isEndOfWalk ( const Oid& currentDeviceOid, const Oid& nextDeviceOid, const netsnmp_variable_list * vars );
+
+	/**
+	 * Decodes the first varbind of a response as T, see SnmpTypeTraits
+	 * @return Snmp_BadNoDataAvailable when the varbind has a type T cannot be read from
+	 */
+	template <typename T>
+	static std::pair<SnmpStatus, T> decodeResponse ( const netsnmp_pdu * response, const Oid& oidOfInterest )
+	{
+		if ( !response || !response->variables )
+			return std::pair<SnmpStatus, T>(Snmp_Bad, T{});
+
+		const netsnmp_variable_list * vars = response->variables;
+		if ( !SnmpTypeTraits<T>::accepts( vars->type ) )
+		{
+			logUnexpectedType( vars, oidOfInterest );
+			return std::pair<SnmpStatus, T>(Snmp_BadNoDataAvailable, T{});
+		}
+
+		std::pair<SnmpStatus, T> decoded(Snmp_Good, SnmpTypeTraits<T>::decode( vars ));
+		SnmpTracer::instance().mark( SnmpTracer::Phase::Decoded );
+		return decoded;
+	}
+
+	/**
+	 * Gets a value of any type with an SnmpTypeTraits specialization, e.g. snmpGet<int32_t>(oid).
+	 * @param oidOfInterest target oid on remote resource
+	 * @return Snmp_BadNoDataAvailable when the agent answers with a type T cannot be read from,
+	 * Snmp_BadNoCommunication without I/O while the circuit breaker is open
+	 */
+	template <typename T>
+	std::pair<SnmpStatus, T> snmpGet( const Oid& oidOfInterest )
+	{
+		if ( isCircuitOpen() )
+			return std::pair<SnmpStatus, T>(Snmp_BadNoCommunication, T{});
+		PduPtr response = snmpGet( oidOfInterest );
+		return decodeResponse<T>( response.get(), oidOfInterest );
+	}
+
+	template <typename T>
+	std::pair<SnmpStatus, T> snmpGet( const std::string& oidOfInterest )
+	{
+		return snmpGet<T>( prepareOid( oidOfInterest ) );
+	}
+
+	/**
+	 * Zero copy read of an OCTET STRING: the visitor gets a std::string_view into the response
+	 * PDU, valid during the call only.
+	 * @param oidOfInterest target oid on remote resource
+	 * @param visitor callable taking a std::string_view, only invoked on success
+	 */
+	template <typename Visitor>
+	SnmpStatus snmpGetView( const Oid& oidOfInterest, Visitor&& visitor )
+	{
+		if ( isCircuitOpen() )
+			return Snmp_BadNoCommunication;
+		PduPtr response = snmpGet( oidOfInterest );
+		const auto view = decodeResponse<std::string_view>( response.get(), oidOfInterest );
+		if ( view.first == Snmp_Good )
+			visitor( view.second );
+		return view.first;
+	}
+
+	/**
+	 * No-throw GET: timeouts, agent errors and exception values come back as SnmpError instead
+	 * of exceptions and ERR logs, which keeps polling many dead devices cheap.
+	 * @param error set to the reason of the failure, Kind::None on success
+	 * @return the response, nullptr on failure
+	 */
+	PduPtr trySnmpGet( const Oid& oidOfInterest, SnmpError& error );
+
+	/**
+	 * No-throw typed GET, e.g. trySnmpGet<int32_t>(oid), see SnmpTypeTraits
+	 */
+	template <typename T>
+	SnmpResult<T> trySnmpGet( const Oid& oidOfInterest )
+	{
+		SnmpResult<T> result;
+		PduPtr response = trySnmpGet( oidOfInterest, result.error );
+		if ( result.error )
+			return result;
+
+		const netsnmp_variable_list * vars = response->variables;
+		if ( !SnmpTypeTraits<T>::accepts( vars->type ) )
+		{
+			result.error = varbindError( vars );
+			return result;
+		}
+
+		result.value = SnmpTypeTraits<T>::decode( vars );
+		SnmpTracer::instance().mark( SnmpTracer::Phase::Decoded );
+		return result;
+	}
+
+	template <typename T>
+	SnmpResult<T> trySnmpGet( const std::string& oidOfInterest )
+	{
+		Oid prepared;
+		SnmpResult<T> result;
+		if ( !tryPrepareOid( oidOfInterest, prepared, result.error ) )
+			return result;
+		return trySnmpGet<T>( prepared );
+	}
+
+	/**
+	 * No-throw SET
+	 * @return Kind::WrongType when the value cannot be encoded, Kind::None on success
+	 */
+	SnmpError trySnmpSet( const Oid& oidOfInterest, const snmpSetValue& value );
+	SnmpError trySnmpSet( const std::string& oidOfInterest, const snmpSetValue& value );
+
+	/*
+	 *	Every getter and setter comes in two flavours: taking the OID as a string, parsed through
+	 *	the process wide OidCache, or taking an Oid prepared once by the caller.
+	 */
 	std::pair<SnmpStatus, int32_t> snmpGetInt( const std::string& oidOfInterest );
+	std::pair<SnmpStatus, int32_t> snmpGetInt( const Oid& oidOfInterest );
+	// Unsigned32/Gauge32 only, snmpGet<uint32_t> also reads Counter32 and TimeTicks
 	std::pair<SnmpStatus, uint32_t> snmpGetUInt( const std::string& oidOfInterest );
+	std::pair<SnmpStatus, uint32_t> snmpGetUInt( const Oid& oidOfInterest );
 	std::pair<SnmpStatus, unsigned char > snmpGetBoolean( const std::string& oidOfInterest );
+	std::pair<SnmpStatus, unsigned char > snmpGetBoolean( const Oid& oidOfInterest );
 	std::pair<SnmpStatus, std::string> snmpGetString( const std::string& oidOfInterest );
+	std::pair<SnmpStatus, std::string> snmpGetString( const Oid& oidOfInterest );
 	std::pair<SnmpStatus, std::string> snmpGetTime( const std::string& oidOfInterest );
+	std::pair<SnmpStatus, std::string> snmpGetTime( const Oid& oidOfInterest );
 	std::pair<SnmpStatus, std::vector<uint8_t>> snmpGetHex( const std::string& oidOfInterest );
+	std::pair<SnmpStatus, std::vector<uint8_t>> snmpGetHex( const Oid& oidOfInterest );
+	std::pair<SnmpStatus, uint64_t> snmpGetCounter64( const std::string& oidOfInterest );
+	std::pair<SnmpStatus, uint64_t> snmpGetCounter64( const Oid& oidOfInterest );
+	std::pair<SnmpStatus, TimeTicks> snmpGetTimeTicks( const std::string& oidOfInterest );
+	std::pair<SnmpStatus, TimeTicks> snmpGetTimeTicks( const Oid& oidOfInterest );
+	std::pair<SnmpStatus, IpAddress> snmpGetIpAddress( const std::string& oidOfInterest );
+	std::pair<SnmpStatus, IpAddress> snmpGetIpAddress( const Oid& oidOfInterest );
+
+	/**
+	 * Gets a float or double sent as net-snmp's Opaque float or double, without going through text
+	 */
+	std::pair<SnmpStatus, float> snmpGetFloat( const std::string& oidOfInterest );
+	std::pair<SnmpStatus, float> snmpGetFloat( const Oid& oidOfInterest );
+	std::pair<SnmpStatus, double> snmpGetDouble( const std::string& oidOfInterest );
+	std::pair<SnmpStatus, double> snmpGetDouble( const Oid& oidOfInterest );
 
 	/**
 	 * Gets a float value where the underlying SNMP data format is string. So, reads string value
@@ -143,6 +412,14 @@ public:
 	 * @return float value parsed from the SNMP string value
 	 */
 	std::pair<SnmpStatus, float> snmpGetFloatFromString( const std::string& oidOfInterest );
+	std::pair<SnmpStatus, float> snmpGetFloatFromString( const Oid& oidOfInterest );
+
+	/**
+	 * Parses the number text starts with, like std::stof: leading blanks are skipped, trailing
+	 * text such as units is ignored. No allocation, no exception.
+	 * @return Snmp_BadDataUnavailable when text does not start with a number
+	 */
+	static std::pair<SnmpStatus, float> floatFromString( std::string_view text );
 
 	/**
 	 * Gets a float value where the underlying SNMP data format is string. So, reads int value
@@ -153,14 +430,141 @@ public:
 	 * @return float value scaled according to the scale factor
 	 */
 	std::pair<SnmpStatus, float> snmpGetFloatFromInt( const std::string& oidOfInterest, const float& scaleFactor );
+	std::pair<SnmpStatus, float> snmpGetFloatFromInt( const Oid& oidOfInterest, const float& scaleFactor );
+
+	/**
+	 * Gets many OIDs with as few round trips as possible. OIDs are packed into GET PDUs of up to
+	 * Constants::SNMP_MAX_VARBINDS_PER_PDU varbinds, a PDU refused with tooBig is split in halves.
+	 * @param oidsOfInterest target oids on remote resource
+	 * @return per-OID status and value, in the order of oidsOfInterest
+	 */
+	std::vector<std::pair<SnmpStatus, snmpGetValue>> snmpGetMany( const std::vector<std::string>& oidsOfInterest );
+	std::vector<std::pair<SnmpStatus, snmpGetValue>> snmpGetMany( const std::vector<Oid>& oidsOfInterest );
+
+	/**
+	 * Walks the device starting from the seed OID, until the walked OIDs leave the level of the seed.
+	 * SNMPv2c/v3 devices are walked with GETBULK, SNMPv1 devices with GETNEXT.
+	 * @param seedOid oid to start walking from (exclusive)
+	 * @param maxRepetitions varbinds requested per GETBULK PDU, 0 forces a GETNEXT walk
+	 * @return the walked OIDs
+	 */
+	std::vector<Oid> snmpDeviceWalk ( const std::string& seedOid, long maxRepetitions = Snmp::Constants::SNMP_WALK_MAX_REPETITIONS );
+
+	/**
+	 * Gets the OID and the decoded value of every walked varbind
+	 * @return false to stop the walk
+	 */
+	typedef std::function<bool(const Oid&, SnmpStatus, const snmpGetValue&)> WalkVisitor;
+
+	/**
+	 * Streams the subtree below rootOid to the visitor, one response PDU at a time, so that the
+	 * values come with the walk and memory stays flat whatever the size of the table.
+	 * SNMPv2c/v3 devices are walked with GETBULK, SNMPv1 devices with GETNEXT.
+	 * @param rootOid oid whose subtree is walked (exclusive)
+	 * @param visitor invoked per varbind, returns false to stop early
+	 * @param maxRepetitions varbinds requested per GETBULK PDU, 0 forces a GETNEXT walk
+	 * @return number of varbinds handed to the visitor
+	 */
+	size_t snmpWalk ( const Oid& rootOid, const WalkVisitor& visitor, long maxRepetitions = Snmp::Constants::SNMP_WALK_MAX_REPETITIONS );
+	size_t snmpWalk ( const std::string& rootOid, const WalkVisitor& visitor, long maxRepetitions = Snmp::Constants::SNMP_WALK_MAX_REPETITIONS );
+
+	/**
+	 * Typed streaming walk, e.g. snmpWalk<uint32_t>(column, visitor): the visitor gets (const Oid&, T)
+	 * and returns false to stop. Varbinds of a type T cannot be read from are skipped. With
+	 * std::string_view the value points into the response PDU, valid during the call only.
+	 */
+	template <typename T, typename Visitor>
+	size_t snmpWalk ( const Oid& rootOid, Visitor&& visitor, long maxRepetitions = Snmp::Constants::SNMP_WALK_MAX_REPETITIONS )
+	{
+		size_t visited = 0;
+		walkVarbinds( rootOid, maxRepetitions, [&] ( const Oid& walkedOid, const netsnmp_variable_list * vars ) {
+			if ( !rootOid.isPrefixOf( walkedOid ) )
+				return false;
+			if ( !SnmpTypeTraits<T>::accepts( vars->type ) )
+			{
+				logUnexpectedType( vars, walkedOid );
+				return true;
+			}
+			visited++;
+			return static_cast<bool>( visitor( walkedOid, SnmpTypeTraits<T>::decode( vars ) ) );
+		});
+		return visited;
+	}
+
+	/**
+	 * Fetches columns of a conceptual table at once: every GETBULK PDU carries one varbind per
+	 * column not finished yet, and each column ends on its own when the agent leaves it.
+	 * SNMPv1 devices are read with GETNEXT, one row of all the columns per PDU. When a single
+	 * row is too big for the agent, the columns are fetched in halves instead.
+	 * @param tableOid oid of the table, e.g. ifTable, its entry is tableOid.1
+	 * @param columns sub-identifiers of the columns below the entry, e.g. {2, 5} for ifDescr and ifSpeed
+	 * @param maxRepetitions rows requested per GETBULK PDU, 0 forces GETNEXT
+	 */
+	SnmpTable snmpGetTable( const Oid& tableOid, const std::vector<oid>& columns, long maxRepetitions = Snmp::Constants::SNMP_WALK_MAX_REPETITIONS );
+	SnmpTable snmpGetTable( const std::string& tableOid, const std::vector<oid>& columns, long maxRepetitions = Snmp::Constants::SNMP_WALK_MAX_REPETITIONS );
+
+	/**
+	 * Sets many OIDs with as few round trips as possible. Without atomic, varbinds are packed
+	 * into SET PDUs like snmpGetMany packs GETs: a PDU refused with tooBig is split in halves,
+	 * and one the agent refuses because of a single varbind is sent again without it. With
+	 * atomic, all the varbinds go in one PDU, which the agent applies entirely or not at all.
+	 * @param varbinds target oids on remote resource with the values to write
+	 * @param atomic all or nothing, the agent must take them all in one PDU
+	 * @return per-varbind outcome in the order of varbinds, Kind::None when written, the agent's
+	 * error-status (see SnmpError::agentError) on the varbind it refused, Kind::NotApplied on
+	 * the others of a failed PDU
+	 */
+	std::vector<SnmpError> snmpSetMany( const std::vector<std::pair<Oid, snmpSetValue>>& varbinds, bool atomic = false );
+	std::vector<SnmpError> snmpSetMany( const std::vector<std::pair<std::string, snmpSetValue>>& varbinds, bool atomic = false );
 
-	std::vector<Oid> snmpDeviceWalk ( const std::string& seedOid );
 	netsnmp_pdu * snmpGetNext( const std::string& oidOfInterest );
+	netsnmp_pdu * snmpGetNext( const Oid& oidOfInterest );
+	netsnmp_pdu * snmpGetBulk( const std::string& oidOfInterest, long maxRepetitions );
+	netsnmp_pdu * snmpGetBulk( const Oid& oidOfInterest, long maxRepetitions );
 	SnmpStatus snmpSet( const std::string& oidOfInterest, snmpSetValue & value );
+	SnmpStatus snmpSet( const Oid& oidOfInterest, snmpSetValue & value );
 	PduPtr snmpGet( const std::string& oidOfInterest );
+	PduPtr snmpGet( const Oid& oidOfInterest );
 
 	std::string getHostName() { return m_hostname; };
 
+	/**
+	 * Opens more sessions to the device, so that up to sessions requests are in flight at once.
+	 * Only for agents able to serve parallel requests. The pool never shrinks.
+	 * Not thread safe, call before the backend is shared between threads.
+	 */
+	void setSessionPoolSize( size_t sessions );
+	size_t getSessionPoolSize() const { return m_sessionPool.size(); };
+
+	/**
+	 * Derives the timeout of every request from the round trip times measured on this device,
+	 * starting from the constructor's timeout. Retries keep their number but use the backed off
+	 * timeout. Not thread safe, call before the backend is shared between threads.
+	 */
+	void setAdaptiveTimeout( const RttEstimatorOptions& options = RttEstimatorOptions() );
+	bool isAdaptiveTimeout() const { return m_rttEstimator != nullptr; };
+
+	/**
+	 * @return the current round trip estimate, only the fixed timeout without adaptive timeout
+	 */
+	RttEstimator::Estimate getRttEstimate() const;
+
+	/**
+	 * Fails requests fast while the device is known to be down, see CircuitBreaker. Status
+	 * returning calls give Snmp_BadNoCommunication, the others throw DeviceUnavailableException.
+	 * Not thread safe, call before the backend is shared between threads.
+	 * @param listener told about every state transition, on the thread of the request making it
+	 */
+	void setCircuitBreaker( const CircuitBreakerOptions& options = CircuitBreakerOptions(), CircuitBreaker::StateListener listener = nullptr );
+	CircuitBreaker::State getCircuitState() const;
+
+	/**
+	 * Counters of the requests sent to this device since construction or the last reset, see
+	 * SnmpMetrics::Snapshot::aggregate to sum them over many backends
+	 */
+	SnmpMetrics::Snapshot getMetrics() const { return m_metrics.snapshot(); };
+	void resetMetrics() { m_metrics.reset(); };
+
 };
 
 } // Snmp
@@ -31,6 +31,7 @@
 #pragma once
 
 #include <string>
+#include <cstddef>
 
 namespace Snmp
 {
@@ -40,6 +41,20 @@ namespace Snmp
 
 	int const SNMP_TIMEOUT = 1000000;
 	int const SNMP_MAX_RETRIES = 2;
+	size_t const SNMP_MAX_VARBINDS_PER_PDU = 64;
+	long const SNMP_WALK_MAX_REPETITIONS = 25;
+	// bounds of adaptive timeouts, in us
+	int const SNMP_RTT_FLOOR = 20000;
+	int const SNMP_RTT_CEILING = 5000000;
+	// circuit breaker of unreachable devices, durations in us
+	unsigned const SNMP_CIRCUIT_FAILURE_THRESHOLD = 3;
+	int const SNMP_CIRCUIT_OPEN_DURATION = 1000000;
+	int const SNMP_CIRCUIT_MAX_OPEN_DURATION = 60000000;
+	// request tracing, events kept per thread
+	size_t const SNMP_TRACE_EVENTS_PER_THREAD = 16384;
+	// walk snapshots: OIDs read back to validate one, and the slack of its sysUpTime check in us
+	size_t const SNMP_SNAPSHOT_VALIDATION_SAMPLES = 8;
+	int const SNMP_SNAPSHOT_UPTIME_TOLERANCE = 60000000;
 
     enum Pdu
     {
@@ -76,7 +91,8 @@ namespace Snmp
     enum Exceptions
     {
         NO_SUCH_OBJECT = 0,
-        NO_SUCH_INSTANCE = 1
+        NO_SUCH_INSTANCE = 1,
+        END_OF_MIB_VIEW = 2
     };
 
   }
@@ -41,6 +41,12 @@ public:
     explicit TimeoutException( const std::string& what): std::runtime_error(what) {}
 };
 
+class DeviceUnavailableException: public std::runtime_error
+{
+public:
+    explicit DeviceUnavailableException( const std::string& what): std::runtime_error(what) {}
+};
+
 }
 #if defined (_MSC_VER ) // i.e. being compiled by MS vis studio
   #define __PRETTY_FUNCTION__ __FUNCSIG__ // because MS vis studio has no __PRETTY_FUNCTION__
@@ -0,0 +1,85 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <string>
+#include <mutex>
+#include <atomic>
+
+namespace Snmp
+{
+
+struct SnmpLibraryOptions
+{
+	enum class MibLoading
+	{
+		// whatever $MIBS and $MIBDIRS say, net-snmp's default
+		FromEnvironment,
+		// no MIB at all, OIDs must be numeric
+		None,
+		// only the modules listed in mibs
+		List
+	};
+
+	MibLoading mibLoading = MibLoading::FromEnvironment;
+	// colon separated MIB modules, used with MibLoading::List
+	std::string mibs;
+	// colon separated MIB directories, overrides $MIBDIRS when not empty
+	std::string mibDirectories;
+	// snmp.conf and persistent state files
+	bool readConfigurationFiles = true;
+};
+
+/**
+ * Process wide, once only initialization of net-snmp. SnmpBackend initializes with default
+ * options on first construction, call initialize() before to choose other ones.
+ */
+class SnmpLibrary
+{
+
+public:
+	/**
+	 * Thread safe. Only the first call has an effect, the options of later calls are ignored.
+	 * @return true if this call initialized the library
+	 */
+	static bool initialize( const SnmpLibraryOptions& options = SnmpLibraryOptions() );
+
+	static bool isInitialized() { return s_initialized; };
+
+private:
+	static void doInitialize( const SnmpLibraryOptions& options );
+
+	static std::once_flag s_once;
+	static std::atomic<bool> s_initialized;
+
+};
+
+} // Snmp
@@ -0,0 +1,146 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+
+#include <SnmpDefinitions.h>
+
+namespace Snmp
+{
+
+/**
+ * Request counters and latency histograms of one SnmpBackend. Recording is lock free, made of
+ * relaxed atomic increments only.
+ */
+class SnmpMetrics
+{
+
+public:
+	// Constants::Pdu values
+	static constexpr size_t PDU_TYPES = 6;
+	// SNMP_ERR_NOERROR to SNMP_ERR_INCONSISTENTNAME
+	static constexpr size_t ERROR_STATUSES = 19;
+	// bucket i counts values in [2^(i-1), 2^i) us, bucket 0 counts 0 us
+	static constexpr size_t LATENCY_BUCKETS = 32;
+
+	/**
+	 * Plain copy of the counters, to read, compare or aggregate
+	 */
+	struct Snapshot
+	{
+		std::array<uint64_t, PDU_TYPES> requests{};
+		uint64_t varbindsSent = 0;
+		uint64_t varbindsReceived = 0;
+		// BER size of the varbinds, without message headers and security parameters
+		uint64_t varbindBytesSent = 0;
+		uint64_t varbindBytesReceived = 0;
+		uint64_t timeouts = 0;
+		// requests which could not be sent, or whose response could not be parsed
+		uint64_t sendErrors = 0;
+		// refused by the circuit breaker
+		uint64_t rejected = 0;
+		// responses by error-status, index 0 is noError
+		std::array<uint64_t, ERROR_STATUSES> errorStatuses{};
+		std::array<uint64_t, LATENCY_BUCKETS> latency{};
+		// time spent waiting for a free session of the pool
+		uint64_t sessionWaitUs = 0;
+		uint64_t maxSessionWaitUs = 0;
+
+		uint64_t totalRequests() const;
+		double varbindsPerRequest() const;
+
+		/**
+		 * @param quantile in [0, 1], e.g. 0.99
+		 * @return upper bound of the latency bucket holding the quantile, 0 without requests
+		 */
+		uint64_t latencyPercentileUs( double quantile ) const;
+
+		Snapshot& operator+=( const Snapshot& other );
+
+		/**
+		 * Sums the counters of many backends, e.g. all the chassis of a server
+		 */
+		static Snapshot aggregate( const std::vector<Snapshot>& snapshots );
+	};
+
+	SnmpMetrics();
+
+	// CppCoreGuidelines C.21
+	SnmpMetrics(const SnmpMetrics&) = delete;
+	SnmpMetrics& operator=(const SnmpMetrics&) = delete;
+
+	void recordSessionWait( std::chrono::microseconds wait );
+	void recordRequest( const netsnmp_pdu * request );
+	/**
+	 * @param status STAT_SUCCESS, STAT_TIMEOUT or STAT_ERROR
+	 */
+	void recordResponse( int status, const netsnmp_pdu * response, std::chrono::microseconds latency );
+	void recordRejected();
+
+	/**
+	 * Counters are read one by one, a snapshot taken during requests may be off by these requests
+	 */
+	Snapshot snapshot() const;
+	void reset();
+
+	/**
+	 * @return BER size of the varbinds of a PDU
+	 */
+	static size_t varbindBytes( const netsnmp_pdu * pdu );
+
+private:
+	template <size_t N>
+	using Counters = std::array<std::atomic<uint64_t>, N>;
+
+	Counters<PDU_TYPES> m_requests;
+	std::atomic<uint64_t> m_varbindsSent;
+	std::atomic<uint64_t> m_varbindsReceived;
+	std::atomic<uint64_t> m_varbindBytesSent;
+	std::atomic<uint64_t> m_varbindBytesReceived;
+	std::atomic<uint64_t> m_timeouts;
+	std::atomic<uint64_t> m_sendErrors;
+	std::atomic<uint64_t> m_rejected;
+	Counters<ERROR_STATUSES> m_errorStatuses;
+	Counters<LATENCY_BUCKETS> m_latency;
+	std::atomic<uint64_t> m_sessionWaitUs;
+	std::atomic<uint64_t> m_maxSessionWaitUs;
+
+};
+
+} // Snmp
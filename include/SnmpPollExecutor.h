@@ -0,0 +1,136 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <string>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <future>
+#include <chrono>
+#include <functional>
+
+#include <SnmpBackend.h>
+#include <WorkStealingThreadPool.h>
+
+namespace Snmp
+{
+
+struct SnmpPollCycleReport
+{
+	uint64_t cycle = 0;
+	// jobs which ran to completion
+	size_t completed = 0;
+	// jobs which threw
+	size_t failed = 0;
+	// backends still busy with an earlier cycle, not polled in this one
+	size_t skipped = 0;
+	std::chrono::microseconds duration{0};
+	std::chrono::microseconds slowestJob{0};
+	std::string slowestHostname;
+};
+
+/**
+ * Polls many backends on a work stealing thread pool. Every backend has one poll job, and a
+ * backend never has more than one job in flight: a backend still busy when the next cycle
+ * starts is skipped for that cycle.
+ */
+class SnmpPollExecutor
+{
+
+public:
+	typedef std::function<void(SnmpBackend&)> PollJob;
+	typedef std::function<void(const SnmpPollCycleReport&)> CycleCallback;
+
+	explicit SnmpPollExecutor( size_t threads = std::thread::hardware_concurrency() );
+	~SnmpPollExecutor() = default;
+
+	// CppCoreGuidelines C.21
+	SnmpPollExecutor(const SnmpPollExecutor&) = delete;
+	SnmpPollExecutor& operator=(const SnmpPollExecutor&) = delete;
+	SnmpPollExecutor(SnmpPollExecutor&&) = delete;
+	SnmpPollExecutor& operator=(SnmpPollExecutor&&) = delete;
+
+	/**
+	 * Sets the poll job of a backend, replacing the previous one. Takes effect from the next cycle.
+	 */
+	void addJob( SnmpBackend& backend, PollJob job );
+
+	/**
+	 * Removes the poll job of a backend. Returns once the backend has no job in flight anymore,
+	 * except when called from that job: it returns right away then, and the backend must
+	 * outlive the job.
+	 */
+	void removeJob( SnmpBackend& backend );
+
+	/**
+	 * Starts polling every backend once.
+	 * @param callback optional, invoked on the worker finishing the cycle
+	 * @return report of the cycle, available once all its jobs finished
+	 */
+	std::future<SnmpPollCycleReport> runCycle( CycleCallback callback = nullptr );
+
+	size_t threads() const { return m_pool.size(); };
+
+private:
+
+	struct BackendSlot
+	{
+		SnmpBackend * backend;
+		std::mutex jobMutex;
+		PollJob job;
+		std::atomic<bool> inFlight{false};
+	};
+
+	struct CycleState
+	{
+		std::mutex mutex;
+		SnmpPollCycleReport report;
+		std::atomic<size_t> remaining{0};
+		std::chrono::steady_clock::time_point start;
+		std::promise<SnmpPollCycleReport> promise;
+		CycleCallback callback;
+	};
+
+	void runJob( const std::shared_ptr<BackendSlot>& slot, const std::shared_ptr<CycleState>& cycle );
+	static void finishCycle( CycleState& cycle );
+
+	std::mutex m_slotsMutex;
+	std::map<SnmpBackend*, std::shared_ptr<BackendSlot>> m_slots;
+	std::atomic<uint64_t> m_cycles;
+
+	// Last member, so that in flight jobs finish before anything else is destroyed
+	WorkStealingThreadPool m_pool;
+
+};
+
+} // Snmp
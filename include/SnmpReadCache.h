@@ -0,0 +1,119 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <future>
+#include <memory>
+#include <atomic>
+#include <chrono>
+
+#include <Oid.h>
+#include <SnmpBackend.h>
+
+namespace Snmp
+{
+
+/**
+ * Read-through cache in front of SnmpBackend::snmpGet. Responses are kept for the TTL of their
+ * OID, and concurrent reads of an OID which is not cached share a single request ("single flight").
+ */
+class SnmpReadCache
+{
+
+public:
+	struct Statistics
+	{
+		// answered from a fresh cached response
+		uint64_t hits = 0;
+		// sent to the device
+		uint64_t misses = 0;
+		// waited for the response of a request sent for another caller
+		uint64_t coalesced = 0;
+	};
+
+	/**
+	 * @param backend device to read from, must outlive the cache
+	 * @param defaultTtl TTL of OIDs without rule, zero means requests are coalesced but not cached
+	 */
+	explicit SnmpReadCache( SnmpBackend& backend, std::chrono::milliseconds defaultTtl = std::chrono::milliseconds(0) );
+
+	/**
+	 * Sets the TTL of an OID and of every OID below it. The rule with the longest matching prefix wins.
+	 */
+	void setTtl( const Oid& prefix, std::chrono::milliseconds ttl );
+
+	/**
+	 * @return the response to a GET of the OID, shared with other callers. Throws like SnmpBackend::snmpGet
+	 */
+	std::shared_ptr<const netsnmp_pdu> get( const Oid& oidOfInterest );
+
+	template <typename T>
+	std::pair<SnmpStatus, T> get( const Oid& oidOfInterest )
+	{
+		const auto response = get( oidOfInterest );
+		return SnmpBackend::decodeResponse<T>( response.get(), oidOfInterest );
+	}
+
+	void invalidate( const Oid& oidOfInterest );
+	void clear();
+
+	Statistics getStatistics() const;
+	void resetStatistics();
+
+private:
+
+	typedef std::shared_ptr<const netsnmp_pdu> SharedPdu;
+
+	struct Entry
+	{
+		std::shared_future<SharedPdu> response;
+		std::chrono::steady_clock::time_point expiry;
+		bool ready;
+	};
+
+	std::chrono::milliseconds ttlFor( const Oid& oidOfInterest ) const;
+
+	SnmpBackend& m_backend;
+	const std::chrono::milliseconds m_defaultTtl;
+
+	mutable std::mutex m_mutex;
+	std::map<Oid, Entry> m_entries;
+	std::map<Oid, std::chrono::milliseconds> m_ttls;
+
+	std::atomic<uint64_t> m_hits;
+	std::atomic<uint64_t> m_misses;
+	std::atomic<uint64_t> m_coalesced;
+
+};
+
+} // Snmp
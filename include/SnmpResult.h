@@ -0,0 +1,114 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+#include <SnmpStatus.h>
+#include <SnmpDefinitions.h>
+
+namespace Snmp
+{
+
+/**
+ * Why a request failed, as a value: built without exception nor string formatting, so that
+ * failing devices cost no more than answering ones.
+ */
+struct SnmpError
+{
+	enum class Kind
+	{
+		// no error
+		None,
+		// no answer within the timeout and retries
+		Timeout,
+		// the request could not be sent, or the answer not read
+		SendError,
+		// refused without I/O, see SnmpBackend::setCircuitBreaker
+		CircuitOpen,
+		// the agent answered with a non zero error-status, see agentError()
+		AgentError,
+		// the agent answered with an exception value instead of a value, see exception
+		Exception,
+		// the agent answered with a value of a type which cannot be read as requested
+		WrongType,
+		// the OID string could not be parsed
+		InvalidOid,
+		// not written: the SET PDU carrying it failed on another varbind, or was never sent
+		NotApplied
+	};
+
+	Kind kind = Kind::None;
+
+	// error-status of the response as net-snmp has it (SNMP_ERR_*), for Kind::AgentError
+	long errorStatus = 0;
+	// 1-based position of the varbind the agent blames, 0 for none
+	long errorIndex = 0;
+	// for Kind::Exception
+	Constants::Exceptions exception = Constants::NO_SUCH_OBJECT;
+
+	explicit operator bool() const { return kind != Kind::None; };
+
+	/**
+	 * errorStatus as Constants::Errors. SNMPv1 readOnly reads as NOT_WRITABLE,
+	 * authorizationError as NO_ACCESS, unknown codes as GENERIC_ERROR.
+	 */
+	Constants::Errors agentError() const;
+
+	/**
+	 * Status the status returning API reports for this error
+	 */
+	SnmpStatus status() const;
+
+	std::string toString() const;
+
+	static const char * kindToString( Kind kind );
+
+	static SnmpError agent( long errorStatus, long errorIndex );
+	static SnmpError exceptionValue( Constants::Exceptions exception );
+	static SnmpError of( Kind kind );
+};
+
+/**
+ * Value or error of a no-throw request, the value is default constructed on error
+ */
+template <typename T>
+struct SnmpResult
+{
+	SnmpError error;
+	T value{};
+
+	bool ok() const { return !error; };
+	SnmpStatus status() const { return error.status(); };
+};
+
+} // Snmp
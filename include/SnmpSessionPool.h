@@ -0,0 +1,115 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+
+namespace Snmp
+{
+
+/**
+ * Sessions open towards one device. A session serves one synchronous request at a time, the
+ * pool lets up to size() requests be in flight at once. Checking out a session is lock free,
+ * callers only block when every session is busy.
+ */
+class SnmpSessionPool
+{
+
+public:
+
+	/**
+	 * Checked out session, returned to the pool on destruction
+	 */
+	class Lease
+	{
+	public:
+		Lease( SnmpSessionPool& pool, size_t slot ) : m_pool(&pool), m_slot(slot) {};
+		~Lease() { if (m_pool) m_pool->release(m_slot); };
+
+		Lease(const Lease&) = delete;
+		Lease& operator=(const Lease&) = delete;
+		Lease(Lease&& other) : m_pool(other.m_pool), m_slot(other.m_slot) { other.m_pool = nullptr; };
+		Lease& operator=(Lease&&) = delete;
+
+		void * get() const { return m_pool->m_slots[m_slot]->sessp; };
+
+	private:
+		SnmpSessionPool * m_pool;
+		size_t m_slot;
+	};
+
+	SnmpSessionPool() : m_next(0), m_waiters(0) {};
+	~SnmpSessionPool() { closeAll(); };
+
+	SnmpSessionPool(const SnmpSessionPool&) = delete;
+	SnmpSessionPool& operator=(const SnmpSessionPool&) = delete;
+
+	/**
+	 * Adds an open session (snmp_sess_open handle), owned by the pool from now on.
+	 * Not thread safe, only while no session is checked out.
+	 */
+	void add( void * sessp );
+
+	/**
+	 * Closes all the sessions. Not thread safe, only while no session is checked out.
+	 */
+	void closeAll();
+
+	Lease acquire();
+
+	size_t size() const { return m_slots.size(); };
+
+private:
+
+	struct Slot
+	{
+		void * sessp;
+		std::atomic<bool> busy{false};
+	};
+
+	bool tryAcquire( size_t& slot );
+	void release( size_t slot );
+
+	std::vector<std::unique_ptr<Slot>> m_slots;
+	std::atomic<size_t> m_next;
+
+	// Slow path, when all sessions are busy
+	std::mutex m_waitMutex;
+	std::condition_variable m_released;
+	std::atomic<size_t> m_waiters;
+
+};
+
+} // Snmp
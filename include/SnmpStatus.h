@@ -35,6 +35,9 @@ enum SnmpStatus : uint32_t
 { 
     Snmp_Good = 0x00000000, 
     Snmp_Bad = 0x80000000,
+    Snmp_BadCommunicationError = 0x80050000,
+    Snmp_BadTimeout = 0x800A0000,
+    Snmp_BadNoCommunication = 0x80310000,
     Snmp_BadNotSupported = 0x803D0000,
     Snmp_BadNotImplemented = 0x80400000,
     Snmp_BadDataUnavailable = 0x809E0000,
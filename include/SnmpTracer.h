@@ -0,0 +1,184 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+#include <SnmpDefinitions.h>
+
+namespace Snmp
+{
+
+/**
+ * Where the time of synchronous requests goes: every request leaves timestamped events at the
+ * phases it passes, in a ring buffer of the thread running it. Writing an event takes no lock
+ * and touches no memory shared with other threads; while disabled every hook is a single
+ * relaxed load, so tracing can stay compiled in and be switched on in production.
+ *
+ * A request starts when its OID is parsed, or at the session wait when it comes with a
+ * prepared Oid, and belongs to the thread running it. Requests of SnmpAsyncEngine are not traced.
+ * The library gives no hook before a PDU goes on the wire, so the round trip slice starts with
+ * the session acquired and covers encoding and retransmissions as well.
+ *
+ * Rings outlive their threads, so a dump also shows threads gone since, and are taken over by
+ * threads started later: a thread number in dumps may stand for several threads one after the
+ * other. Events overwritten while a dump reads them are left out of it.
+ */
+class SnmpTracer
+{
+
+public:
+	enum class Phase : uint8_t
+	{
+		Enqueued,
+		OidPrepared,
+		SessionAcquired,
+		Received,
+		Decoded
+	};
+
+	struct Event
+	{
+		// steady clock, in ns
+		uint64_t timestampNs;
+		// unique in the process, 0 never used
+		uint64_t requestId;
+		// see registerDevice
+		uint32_t device;
+		// order of first trace of the thread
+		uint32_t thread;
+		Phase phase;
+	};
+
+	static SnmpTracer& instance();
+
+	/**
+	 * Starts tracing. Rings are sized on the first event of their thread, later calls do not
+	 * resize rings created before.
+	 * @param eventsPerThread capacity of each ring, rounded up to a power of two
+	 */
+	void enable( size_t eventsPerThread = Constants::SNMP_TRACE_EVENTS_PER_THREAD );
+	void disable();
+	bool isEnabled() const { return m_enabled.load( std::memory_order_relaxed ); };
+
+	/**
+	 * Names a device for dumps, devices of the same name share their number
+	 * @return the device number to pass to begin
+	 */
+	uint32_t registerDevice( const std::string& name );
+
+	/**
+	 * Starts a request of device on this thread and records Enqueued
+	 */
+	void begin( uint32_t device )
+	{
+		if ( isEnabled() )
+			beginRequest( device );
+	}
+
+	/**
+	 * Same as begin, unless this thread has prepared the OID of a request of device which is
+	 * not sent yet: that request goes on then
+	 */
+	void enqueue( uint32_t device )
+	{
+		if ( isEnabled() )
+			enqueueRequest( device );
+	}
+
+	/**
+	 * Records phase for the request in progress on this thread, ignored when there is none or
+	 * it is past phase already
+	 */
+	void mark( Phase phase )
+	{
+		if ( isEnabled() )
+			markRequest( phase );
+	}
+
+	/**
+	 * @return events of all the threads, by time
+	 */
+	std::vector<Event> snapshot() const;
+
+	/**
+	 * Writes a trace for chrome://tracing or Perfetto: one track per thread, one slice per
+	 * request with nested slices for its phases. Throws when path cannot be written.
+	 * @return number of events dumped
+	 */
+	size_t dumpChromeTrace( const std::string& path ) const;
+
+	/**
+	 * Writes the events in native byte order: "MULETRC1", uint32 device count, per device a
+	 * uint16 length and its name, uint64 event count, then per event uint64 timestamp, uint64
+	 * request id, uint32 device, uint32 thread, uint8 phase and 7 bytes of padding.
+	 * Throws when path cannot be written.
+	 * @return number of events dumped
+	 */
+	size_t dumpBinary( const std::string& path ) const;
+
+	static const char * phaseToString( Phase phase );
+
+	// CppCoreGuidelines C.21
+	SnmpTracer(const SnmpTracer&) = delete;
+	SnmpTracer& operator=(const SnmpTracer&) = delete;
+	SnmpTracer(SnmpTracer&&) = delete;
+	SnmpTracer& operator=(SnmpTracer&&) = delete;
+
+private:
+	SnmpTracer();
+	~SnmpTracer();
+
+	struct Ring;
+
+	void beginRequest( uint32_t device );
+	void enqueueRequest( uint32_t device );
+	void markRequest( Phase phase );
+	Ring& threadRing();
+	std::vector<std::string> deviceNames() const;
+
+	std::atomic<bool> m_enabled;
+	std::atomic<size_t> m_eventsPerThread;
+
+	mutable std::mutex m_mutex;
+	std::vector<std::unique_ptr<Ring>> m_rings;
+	std::vector<std::string> m_devices;
+	std::unordered_map<std::string, uint32_t> m_deviceNumbers;
+
+};
+
+} // Snmp
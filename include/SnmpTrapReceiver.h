@@ -0,0 +1,203 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <atomic>
+#include <functional>
+
+#include <Oid.h>
+#include <SnmpBackend.h>
+#include <SnmpStatus.h>
+#include <SnmpDefinitions.h>
+#include <WorkStealingThreadPool.h>
+
+namespace Snmp
+{
+
+/**
+ * SNMPv3 user notifications are accepted from. Same strings as the SnmpBackend constructor.
+ */
+struct SnmpTrapUser
+{
+	std::string username;
+	// noAuthNoPriv|authNoPriv|authPriv
+	std::string securityLevel;
+	// MD5|SHA
+	std::string authenticationProtocol;
+	std::string authenticationPassPhrase;
+	// DES|AES
+	std::string privacyProtocol;
+	std::string privacyPassPhrase;
+	// hex engine ID of the sender, required for traps. Informs use the engine ID of the receiver, leave empty
+	std::string engineId;
+};
+
+struct SnmpTrapReceiverOptions
+{
+	std::string address = "0.0.0.0";
+	// 0 lets the system choose, see SnmpTrapReceiver::getPort()
+	uint16_t port = 162;
+	// SNMPv1/v2c communities accepted, empty accepts any
+	std::vector<std::string> communities;
+	std::vector<SnmpTrapUser> users;
+	size_t handlerThreads = 2;
+};
+
+struct SnmpNotification
+{
+	struct Varbind
+	{
+		Oid name;
+		SnmpStatus status;
+		// OBJECT IDENTIFIER values are given in dotted notation
+		snmpGetValue value;
+	};
+
+	// Constants::TRAP or Constants::INFORM
+	Snmp::Constants::Pdu type;
+	// 1, 2c or 3
+	std::string version;
+	// transport address of the sender
+	std::string source;
+	// community for SNMPv1/v2c, security name for SNMPv3
+	std::string securityName;
+	// sysUpTime of the sender, in hundredths of a second
+	uint32_t upTime = 0;
+	// snmpTrapOID, translated as per RFC 3584 for SNMPv1 traps
+	Oid trapOid;
+	// without sysUpTime.0 and snmpTrapOID.0
+	std::vector<Varbind> varbinds;
+};
+
+/**
+ * Listens for traps and informs on a UDP port and dispatches them to the handlers registered
+ * for their snmpTrapOID. Informs are acknowledged on reception, before the handlers run.
+ *
+ * Handlers are invoked on a thread pool, concurrently with each other.
+ */
+class SnmpTrapReceiver
+{
+
+public:
+	typedef std::function<void(const SnmpNotification&)> Handler;
+	typedef size_t HandlerId;
+
+	struct Statistics
+	{
+		uint64_t received = 0;
+		uint64_t informsAcknowledged = 0;
+		// unexpected PDU type or community
+		uint64_t dropped = 0;
+	};
+
+	/**
+	 * Binds the port and starts listening. Throws when the port cannot be bound or a user is invalid.
+	 */
+	explicit SnmpTrapReceiver( const SnmpTrapReceiverOptions& options = SnmpTrapReceiverOptions() );
+
+	/**
+	 * Stops listening, then waits for the handlers already dispatched.
+	 */
+	~SnmpTrapReceiver();
+
+	// CppCoreGuidelines C.21
+	SnmpTrapReceiver(const SnmpTrapReceiver&) = delete;
+	SnmpTrapReceiver& operator=(const SnmpTrapReceiver&) = delete;
+	SnmpTrapReceiver(SnmpTrapReceiver&&) = delete;
+	SnmpTrapReceiver& operator=(SnmpTrapReceiver&&) = delete;
+
+	/**
+	 * @param trapOidPrefix the handler gets the notifications whose snmpTrapOID starts with it, an empty Oid matches all
+	 */
+	HandlerId addHandler( const Oid& trapOidPrefix, Handler handler );
+	HandlerId addHandler( Handler handler ) { return addHandler( Oid(), std::move(handler) ); };
+
+	/**
+	 * Notifications already dispatched may still reach the handler after removal.
+	 */
+	void removeHandler( HandlerId id );
+
+	/**
+	 * @return the bound port, useful after binding port 0
+	 */
+	uint16_t getPort() const { return m_port; };
+
+	Statistics getStatistics() const;
+
+private:
+
+	struct Registration
+	{
+		HandlerId id;
+		Oid trapOidPrefix;
+		Handler handler;
+	};
+
+	void createUser( const SnmpTrapUser& user );
+	void openTransport( const SnmpTrapReceiverOptions& options );
+	void eventLoop();
+	void wakeUp();
+	void processNotification( netsnmp_pdu * pdu );
+	bool isCommunityAccepted( const netsnmp_pdu * pdu ) const;
+	bool acknowledgeInform( netsnmp_pdu * pdu );
+	std::shared_ptr<SnmpNotification> decodeNotification( netsnmp_pdu * pdu );
+	void dispatch( std::shared_ptr<const SnmpNotification> notification );
+
+	static int notificationCallback( int operation, netsnmp_session *session, int reqid, netsnmp_pdu *pdu, void *magic );
+
+	const std::vector<std::string> m_communities;
+	uint16_t m_port;
+
+	mutable std::shared_mutex m_handlerMutex;
+	std::vector<Registration> m_handlers;
+	HandlerId m_nextHandlerId;
+
+	std::atomic<uint64_t> m_received;
+	std::atomic<uint64_t> m_informsAcknowledged;
+	std::atomic<uint64_t> m_dropped;
+
+	// Destroyed after the loop thread, runs the notifications dispatched before the stop
+	WorkStealingThreadPool m_handlerPool;
+
+	void * m_sessp;
+	std::atomic<bool> m_running;
+	int m_wakeUpPipe[2];
+	std::thread m_thread;
+
+};
+
+} // Snmp
@@ -0,0 +1,175 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+
+namespace Snmp
+{
+
+/**
+ * SMIv2 TimeTicks, e.g. sysUpTime. Read as uint32_t too, this type only tells SET which tag to use.
+ */
+struct TimeTicks
+{
+	// hundredths of a second
+	uint32_t hundredths = 0;
+
+	std::chrono::milliseconds toDuration() const { return std::chrono::milliseconds( static_cast<uint64_t>(hundredths) * 10 ); };
+	bool operator==( const TimeTicks& other ) const { return hundredths == other.hundredths; };
+	bool operator!=( const TimeTicks& other ) const { return hundredths != other.hundredths; };
+};
+
+/**
+ * SMIv2 IpAddress, octets in network order
+ */
+struct IpAddress
+{
+	std::array<uint8_t, 4> octets{};
+
+	std::string toString() const
+	{
+		return std::to_string( octets[0] ) + "." + std::to_string( octets[1] ) + "." + std::to_string( octets[2] ) + "." + std::to_string( octets[3] );
+	};
+	bool operator==( const IpAddress& other ) const { return octets == other.octets; };
+	bool operator!=( const IpAddress& other ) const { return octets != other.octets; };
+};
+
+/**
+ * Maps a C++ type to the ASN.1 types it can be read from and to the decoder of the varbind.
+ * SnmpBackend::snmpGet<T> only compiles for types specialized here.
+ */
+template <typename T>
+struct SnmpTypeTraits;
+
+// ASN.1 INTEGER, SMIv2 Integer32
+template <>
+struct SnmpTypeTraits<int32_t>
+{
+	static bool accepts( u_char type ) { return type == ASN_INTEGER; }
+	static int32_t decode( const netsnmp_variable_list * vars ) { return static_cast<int32_t>(*vars->val.integer); }
+};
+
+// SMIv2 Counter32/Gauge32/TimeTicks/Unsigned32, Gauge32 and Unsigned32 share their tag
+template <>
+struct SnmpTypeTraits<uint32_t>
+{
+	static bool accepts( u_char type ) { return type == ASN_UNSIGNED || type == ASN_COUNTER || type == ASN_TIMETICKS; }
+	// net-snmp transmits unsigned value via signed union element
+	static uint32_t decode( const netsnmp_variable_list * vars ) { return static_cast<uint32_t>(*vars->val.integer); }
+};
+
+// SMIv2 Counter64, high capacity counters such as ifHCInOctets
+template <>
+struct SnmpTypeTraits<uint64_t>
+{
+	static bool accepts( u_char type ) { return type == ASN_COUNTER64; }
+	// both halves are 32 bits wide, whatever the width of u_long
+	static uint64_t decode( const netsnmp_variable_list * vars )
+	{
+		return ( static_cast<uint64_t>( vars->val.counter64->high & 0xffffffff ) << 32 ) | ( vars->val.counter64->low & 0xffffffff );
+	}
+};
+
+// SMIv2 TimeTicks
+template <>
+struct SnmpTypeTraits<TimeTicks>
+{
+	static bool accepts( u_char type ) { return type == ASN_TIMETICKS; }
+	static TimeTicks decode( const netsnmp_variable_list * vars ) { return TimeTicks{ static_cast<uint32_t>(*vars->val.integer) }; }
+};
+
+// SMIv2 IpAddress
+template <>
+struct SnmpTypeTraits<IpAddress>
+{
+	static bool accepts( u_char type ) { return type == ASN_IPADDRESS; }
+	static IpAddress decode( const netsnmp_variable_list * vars )
+	{
+		IpAddress address;
+		std::memcpy( address.octets.data(), vars->val.string, std::min<size_t>( vars->val_len, address.octets.size() ) );
+		return address;
+	}
+};
+
+#ifdef NETSNMP_WITH_OPAQUE_SPECIAL_TYPES
+// Opaque wrapped float of net-snmp, as sent by e.g. UCD-SNMP-MIB laLoadFloat
+template <>
+struct SnmpTypeTraits<float>
+{
+	static bool accepts( u_char type ) { return type == ASN_OPAQUE_FLOAT; }
+	static float decode( const netsnmp_variable_list * vars ) { return *vars->val.floatVal; }
+};
+
+// Opaque wrapped double of net-snmp, Opaque floats widen
+template <>
+struct SnmpTypeTraits<double>
+{
+	static bool accepts( u_char type ) { return type == ASN_OPAQUE_DOUBLE || type == ASN_OPAQUE_FLOAT; }
+	static double decode( const netsnmp_variable_list * vars ) { return vars->type == ASN_OPAQUE_FLOAT ? *vars->val.floatVal : *vars->val.doubleVal; }
+};
+#endif
+
+// ASN.1 OCTET STRING
+template <>
+struct SnmpTypeTraits<std::string>
+{
+	static bool accepts( u_char type ) { return type == ASN_OCTET_STR; }
+	static std::string decode( const netsnmp_variable_list * vars ) { return std::string( reinterpret_cast<const char*>(vars->val.string), vars->val_len ); }
+};
+
+// ASN.1 OCTET STRING, as raw bytes
+template <>
+struct SnmpTypeTraits<std::vector<uint8_t>>
+{
+	static bool accepts( u_char type ) { return type == ASN_OCTET_STR; }
+	static std::vector<uint8_t> decode( const netsnmp_variable_list * vars ) { return std::vector<uint8_t>( vars->val.string, vars->val.string + vars->val_len ); }
+};
+
+// ASN.1 OCTET STRING, as a view into the response PDU, valid as long as the PDU
+template <>
+struct SnmpTypeTraits<std::string_view>
+{
+	static bool accepts( u_char type ) { return type == ASN_OCTET_STR; }
+	static std::string_view decode( const netsnmp_variable_list * vars ) { return std::string_view( reinterpret_cast<const char*>(vars->val.string), vars->val_len ); }
+};
+
+} // Snmp
@@ -0,0 +1,160 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <chrono>
+#include <string>
+#include <cstdint>
+#include <type_traits>
+
+#include <Oid.h>
+#include <SnmpStatus.h>
+#include <SnmpTypeTraits.h>
+
+namespace Snmp
+{
+
+/**
+ * Deadband of a value: a change is published when it exceeds every band set. Without any band,
+ * every change is published.
+ */
+struct SnmpDeadband
+{
+	// change from the last published value, in the unit of the value, 0 for none
+	double absolute = 0.0;
+	// change relative to the last published value, in %, 0 for none
+	double percent = 0.0;
+};
+
+/**
+ * Optional stage between the snmpGet* results and their publication, keeping the last value of
+ * every OID fed to it:
+ *  - shouldPublish suppresses values which did not change beyond their deadband,
+ *  - counterRate turns Counter32/Counter64 samples into rates per second, across counter
+ *    wraps and agent restarts.
+ *
+ * A change of status is always published, a value following a bad status too.
+ *
+ * Thread safe. Meant to be kept next to the backend it processes the results of.
+ */
+class SnmpValueProcessor
+{
+
+public:
+	SnmpValueProcessor() = default;
+
+	// CppCoreGuidelines C.21
+	SnmpValueProcessor(const SnmpValueProcessor&) = delete;
+	SnmpValueProcessor& operator=(const SnmpValueProcessor&) = delete;
+	SnmpValueProcessor(SnmpValueProcessor&&) = delete;
+	SnmpValueProcessor& operator=(SnmpValueProcessor&&) = delete;
+
+	/**
+	 * Deadband of oidOfInterest from now on, the others publish every change
+	 */
+	void setDeadband( const Oid& oidOfInterest, const SnmpDeadband& deadband );
+
+	/**
+	 * @return true when result is to be published, it then becomes the reference of the deadband
+	 */
+	template <typename T>
+	bool shouldPublish( const Oid& oidOfInterest, const std::pair<SnmpStatus, T>& result )
+	{
+		static_assert( std::is_arithmetic<T>::value, "numbers only, strings have their own overload" );
+		return shouldPublishNumber( oidOfInterest, result.first, static_cast<double>( result.second ) );
+	}
+
+	/**
+	 * Strings have no deadband, every change is published
+	 */
+	bool shouldPublish( const Oid& oidOfInterest, const std::pair<SnmpStatus, std::string>& result );
+
+	/**
+	 * Rate of a counter between this sample and the previous one, timed by the agent's sysUpTime
+	 * read in the same PDU (e.g. with snmpGetMany). A sysUpTime going back is a restart of the
+	 * agent, its counters start again: no rate is given for that sample. A counter going back
+	 * without restart wrapped once; counters must be polled faster than they can wrap twice.
+	 * @return the status of a bad sample, which leaves the previous one as reference;
+	 * Snmp_BadNoDataAvailable for the first sample, after a restart or without time elapsed
+	 */
+	std::pair<SnmpStatus, double> counterRate( const Oid& counterOid, const std::pair<SnmpStatus, uint32_t>& counter, const std::pair<SnmpStatus, TimeTicks>& sysUpTime );
+	std::pair<SnmpStatus, double> counterRate( const Oid& counterOid, const std::pair<SnmpStatus, uint64_t>& counter, const std::pair<SnmpStatus, TimeTicks>& sysUpTime );
+
+	/**
+	 * Same, timed by the local clock at the time of the call. Restarts cannot be told from
+	 * wraps then, the first rate after a restart is wrong.
+	 */
+	std::pair<SnmpStatus, double> counterRate( const Oid& counterOid, const std::pair<SnmpStatus, uint32_t>& counter );
+	std::pair<SnmpStatus, double> counterRate( const Oid& counterOid, const std::pair<SnmpStatus, uint64_t>& counter );
+
+	/**
+	 * Forgets the history of oidOfInterest, its next value is published and starts a new rate.
+	 * Its deadband stays.
+	 */
+	void reset( const Oid& oidOfInterest );
+
+	/**
+	 * Forgets the history and the deadbands of every OID
+	 */
+	void clear();
+
+private:
+	struct Published
+	{
+		SnmpStatus status = Snmp_Good;
+		double number = 0.0;
+		std::string text;
+		bool valid = false;
+		SnmpDeadband deadband;
+	};
+
+	struct CounterSample
+	{
+		SnmpStatus status = Snmp_Good;
+		uint64_t value = 0;
+		// in us, from the agent's sysUpTime or the local clock
+		uint64_t timeUs = 0;
+		bool valid = false;
+	};
+
+	bool shouldPublishNumber( const Oid& oidOfInterest, SnmpStatus status, double value );
+	std::pair<SnmpStatus, double> rate( const Oid& counterOid, SnmpStatus status, uint64_t value, uint64_t mask, SnmpStatus timeStatus, uint64_t timeUs, bool restartDetection );
+	static uint64_t localTimeUs();
+
+	std::mutex m_mutex;
+	std::map<Oid, Published> m_published;
+	std::map<Oid, CounterSample> m_counters;
+
+};
+
+} // Snmp
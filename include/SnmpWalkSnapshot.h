@@ -0,0 +1,132 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include <Oid.h>
+#include <SnmpBackend.h>
+#include <SnmpDefinitions.h>
+
+namespace Snmp
+{
+
+/**
+ * Discovered OID trees of one device with their last values, saved to a file which is memory
+ * mapped when loaded: a server restart finds its devices from disk in milliseconds instead of
+ * walking them again, and checks the device only with validate(), in one GET.
+ *
+ * The file holds a header, entries sorted by OID, the sub-identifiers and the values, in native
+ * byte order: it is meant for the host which wrote it. Not thread safe to write, thread safe to
+ * read once loaded.
+ */
+class SnmpWalkSnapshot
+{
+
+public:
+	enum class Validation
+	{
+		// same boot of the agent, the sampled OIDs are all there
+		Valid,
+		// the sampled OIDs are all there but the agent restarted since, values may be old
+		Restarted,
+		// some sampled OID is gone, the device must be walked again
+		Changed,
+		// no answer, nothing can be told
+		Unreachable
+	};
+
+	/**
+	 * Walks the subtrees of rootOids and writes them with the device's sysUpTime to path,
+	 * replacing any previous snapshot at once. Throws when the device cannot be walked or the
+	 * file cannot be written.
+	 * @return number of OIDs saved
+	 */
+	static size_t capture( SnmpBackend& backend, const std::vector<Oid>& rootOids, const std::string& path );
+
+	/**
+	 * Maps the snapshot at path, throws when it cannot be read or is not a valid snapshot
+	 */
+	explicit SnmpWalkSnapshot( const std::string& path );
+	~SnmpWalkSnapshot();
+
+	// CppCoreGuidelines C.21
+	SnmpWalkSnapshot(const SnmpWalkSnapshot&) = delete;
+	SnmpWalkSnapshot& operator=(const SnmpWalkSnapshot&) = delete;
+	SnmpWalkSnapshot(SnmpWalkSnapshot&&) = delete;
+	SnmpWalkSnapshot& operator=(SnmpWalkSnapshot&&) = delete;
+
+	size_t size() const;
+	Oid oidAt( size_t position ) const;
+	std::pair<SnmpStatus, snmpGetValue> valueAt( size_t position ) const;
+
+	/**
+	 * @return position of oidOfInterest, size() when absent
+	 */
+	size_t find( const Oid& oidOfInterest ) const;
+
+	/**
+	 * Replays the subtree below rootOid as snmpWalk would have read it at capture time
+	 * @return number of OIDs handed to the visitor
+	 */
+	size_t walk( const Oid& rootOid, const SnmpBackend::WalkVisitor& visitor ) const;
+
+	/**
+	 * Same result as snmpDeviceWalk: the OIDs below the level of seedOid, seedOid excluded
+	 */
+	std::vector<Oid> deviceWalk( const Oid& seedOid ) const;
+
+	/**
+	 * Checks the snapshot against the live device with a single GET of sysUpTime and of samples
+	 * OIDs spread over the snapshot. The agent restarted when its sysUpTime is behind the one
+	 * captured plus the wall clock time elapsed since, less Constants::SNMP_SNAPSHOT_UPTIME_TOLERANCE.
+	 */
+	Validation validate( SnmpBackend& backend, size_t samples = Constants::SNMP_SNAPSHOT_VALIDATION_SAMPLES ) const;
+
+	static const char * validationToString( Validation validation );
+
+private:
+	struct Header;
+	struct Entry;
+
+	const Entry& entry( size_t position ) const;
+	int compare( const Entry& entry, const Oid& oidOfInterest ) const;
+	size_t lowerBound( const Oid& oidOfInterest ) const;
+
+	std::string m_path;
+	const unsigned char * m_data;
+	size_t m_size;
+
+};
+
+} // Snmp
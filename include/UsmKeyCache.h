@@ -0,0 +1,74 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+
+namespace Snmp
+{
+
+/**
+ * Process wide cache of SNMPv3 user keys (Ku). Deriving a key from a pass phrase hashes 1 MB by
+ * specification, while a fleet of devices usually shares a handful of credentials. Entries are
+ * keyed by protocol and a SHA-1 digest of the pass phrase, the pass phrase itself is not kept.
+ */
+class UsmKeyCache
+{
+
+public:
+	static UsmKeyCache& instance();
+
+	/**
+	 * @return the Ku of the pass phrase for the protocol, derived on first use only.
+	 * Throws when it cannot be derived.
+	 */
+	std::vector<u_char> getKu( const oid * protocol, size_t protocolLength, const std::string& passPhrase );
+
+	size_t size() const;
+	void clear();
+
+private:
+	UsmKeyCache() = default;
+
+	static std::string cacheKey( const oid * protocol, size_t protocolLength, const std::string& passPhrase );
+
+	mutable std::mutex m_mutex;
+	std::unordered_map<std::string, std::vector<u_char>> m_keys;
+
+};
+
+} // Snmp
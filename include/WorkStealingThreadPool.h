@@ -0,0 +1,100 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#pragma once
+
+#include <deque>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+
+namespace Snmp
+{
+
+/**
+ * Fixed size thread pool where every worker owns a task queue. Workers run their own tasks
+ * newest first and, once idle, steal the oldest tasks of the other workers.
+ */
+class WorkStealingThreadPool
+{
+
+public:
+	typedef std::function<void()> Task;
+
+	explicit WorkStealingThreadPool( size_t threads = std::thread::hardware_concurrency() );
+
+	/**
+	 * Runs the tasks still queued, then joins the workers.
+	 */
+	~WorkStealingThreadPool();
+
+	// CppCoreGuidelines C.21
+	WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+	WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+	WorkStealingThreadPool(WorkStealingThreadPool&&) = delete;
+	WorkStealingThreadPool& operator=(WorkStealingThreadPool&&) = delete;
+
+	/**
+	 * Queues a task. Tasks submitted from a worker go to that worker's queue, others are spread
+	 * round robin. Exceptions escaping a task are logged and dropped.
+	 */
+	void submit( Task task );
+
+	size_t size() const { return m_threads.size(); };
+
+private:
+
+	struct WorkerQueue
+	{
+		std::mutex mutex;
+		std::deque<Task> tasks;
+	};
+
+	void workerLoop( size_t index );
+	bool popLocal( size_t index, Task& task );
+	bool steal( size_t index, Task& task );
+
+	std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+
+	std::mutex m_idleMutex;
+	std::condition_variable m_idleCondition;
+	std::atomic<size_t> m_queuedTasks;
+	std::atomic<size_t> m_nextQueue;
+	bool m_running;
+
+	std::vector<std::thread> m_threads;
+
+};
+
+} // Snmp
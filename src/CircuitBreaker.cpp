@@ -0,0 +1,166 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <CircuitBreaker.h>
+
+#include <algorithm>
+
+namespace Snmp
+{
+
+CircuitBreaker::CircuitBreaker( const CircuitBreakerOptions& options, StateListener listener ) :
+				m_options(options),
+				m_listener(std::move(listener)),
+				m_state(State::Closed),
+				m_consecutiveFailures(0),
+				m_openDuration(options.openDurationUs),
+				m_probeInFlight(false)
+{}
+
+bool CircuitBreaker::allowRequest()
+{
+
+	std::unique_lock<std::mutex> guard(m_mutex);
+
+	switch ( m_state )
+	{
+		case State::Closed:
+			return true;
+		case State::Open:
+			if ( Clock::now() < m_probeTime )
+				return false;
+			m_probeInFlight = true;
+			setState( State::HalfOpen, guard );
+			return true;
+		case State::HalfOpen:
+			if ( m_probeInFlight )
+				return false;
+			m_probeInFlight = true;
+			return true;
+	}
+
+	return true;
+
+}
+
+bool CircuitBreaker::isRejecting() const
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+
+	switch ( m_state )
+	{
+		case State::Open:
+			return Clock::now() < m_probeTime;
+		case State::HalfOpen:
+			return m_probeInFlight;
+		default:
+			return false;
+	}
+
+}
+
+void CircuitBreaker::onSuccess()
+{
+
+	std::unique_lock<std::mutex> guard(m_mutex);
+
+	m_consecutiveFailures = 0;
+	if ( m_state == State::Closed )
+		return;
+
+	m_probeInFlight = false;
+	m_openDuration = std::chrono::microseconds( m_options.openDurationUs );
+	setState( State::Closed, guard );
+
+}
+
+void CircuitBreaker::onFailure()
+{
+
+	std::unique_lock<std::mutex> guard(m_mutex);
+
+	switch ( m_state )
+	{
+		case State::Closed:
+			if ( ++m_consecutiveFailures < m_options.failureThreshold )
+				return;
+			break;
+		case State::HalfOpen:
+			// The probe failed, wait longer before the next one
+			m_probeInFlight = false;
+			m_openDuration = std::min( 2 * m_openDuration, std::chrono::microseconds( m_options.maxOpenDurationUs ) );
+			break;
+		case State::Open:
+			// A request sent before the circuit opened
+			return;
+	}
+
+	m_probeTime = Clock::now() + m_openDuration;
+	setState( State::Open, guard );
+
+}
+
+CircuitBreaker::State CircuitBreaker::getState() const
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	return m_state;
+
+}
+
+const char * CircuitBreaker::stateToString( State state )
+{
+
+	switch ( state )
+	{
+		case State::Closed: return "closed";
+		case State::Open: return "open";
+		case State::HalfOpen: return "half-open";
+	}
+	return "unknown";
+
+}
+
+void CircuitBreaker::setState( State state, std::unique_lock<std::mutex>& guard )
+{
+
+	const State previous = m_state;
+	m_state = state;
+
+	if ( !m_listener || previous == state )
+		return;
+
+	guard.unlock();
+	m_listener( previous, state );
+
+}
+
+} // Snmp
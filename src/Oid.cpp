@@ -30,48 +30,192 @@
 
 #include <Oid.h>
 #include <vector>
+#include <algorithm>
+#include <cctype>
 #include <MuleLogComponents.h>
-#include <numeric>
-#include <MuleCommon.h>
+#include <SnmpExceptions.h>
 
 using namespace Snmp;
 using Mule::LogComponentLevels;
 
-Oid::Oid( const std::string& oidOfInterest ) : m_originalString(oidOfInterest)
+Oid::Oid( const std::string& oidOfInterest ) : m_oidSize(0)
 {
 	this->assign(oidOfInterest);
 }
 
+Oid::Oid( const oid * subIdentifiers, size_t length ) : m_oidSize(0)
+{
+	this->assign(subIdentifiers, length);
+}
+
 Oid& Oid::operator()( const std::string& oidOfInterest )
 {
 	this->assign(oidOfInterest);
 	return *this;
 }
 
-void Oid::assign ( std::string oidOfInterest )
+void Oid::assign ( const std::string& oidOfInterest )
 {
 
-	m_originalString = oidOfInterest;
-	m_oidVector.clear();
-	char delim = '.';
+	oid subIdentifiers[MAX_OID_LEN];
+	size_t length = 0;
+	bool numeric = true;
+
+	// Fast path for the dotted numeric form, with or without leading dot
+	size_t position = ( !oidOfInterest.empty() && oidOfInterest[0] == '.' ) ? 1 : 0;
+	while ( numeric && position < oidOfInterest.size() )
+	{
+		if ( length == MAX_OID_LEN || !isdigit( static_cast<unsigned char>(oidOfInterest[position]) ) )
+		{
+			numeric = false;
+			break;
+		}
 
-	std::size_t current, previous = 0;
-	current = oidOfInterest.find(delim);
-	while (current != std::string::npos) {
-		m_oidVector.push_back(oidOfInterest.substr(previous, current - previous));
-		previous = current + 1;
-		current = oidOfInterest.find(delim, previous);
+		oid subIdentifier = 0;
+		while ( position < oidOfInterest.size() && isdigit( static_cast<unsigned char>(oidOfInterest[position]) ) )
+		{
+			subIdentifier = subIdentifier * 10 + ( oidOfInterest[position++] - '0' );
+			// Sub-identifiers are 32 bit, let the library report anything larger
+			if ( subIdentifier > 0xFFFFFFFFUL )
+			{
+				numeric = false;
+				break;
+			}
+		}
+		if ( !numeric )
+			break;
+		subIdentifiers[length++] = subIdentifier;
+
+		if ( position < oidOfInterest.size() )
+		{
+			numeric = ( oidOfInterest[position] == '.' && position + 1 < oidOfInterest.size() );
+			position++;
+		}
+	}
+
+	// Anything else, e.g. SNMPv2-MIB::sysDescr.0, goes through the MIB
+	if ( !numeric )
+	{
+		length = MAX_OID_LEN;
+		if (! snmp_parse_oid(oidOfInterest.c_str(), subIdentifiers, &length))
+		{
+			snmp_perror(oidOfInterest.c_str());
+			snmp_throw_runtime_error_with_origin("Failed to parse OID " + oidOfInterest);
+		}
 	}
-	m_oidVector.push_back(oidOfInterest.substr(previous, current - previous));
 
-	m_oidSize = m_oidVector.size();
+	this->assign(subIdentifiers, length);
+
+}
+
+Oid& Oid::assign ( const oid * subIdentifiers, size_t length )
+{
+
+	std::copy( subIdentifiers, subIdentifiers + length, reserve(length) );
+	m_oidSize = length;
+	return *this;
+
+}
+
+oid * Oid::reserve ( size_t length )
+{
+
+	if ( length <= INLINE_CAPACITY )
+		return m_inline;
+
+	if ( m_oidSize <= INLINE_CAPACITY )
+		m_overflow.assign( m_inline, m_inline + m_oidSize );
+	m_overflow.resize( length );
+	return m_overflow.data();
+
+}
+
+Oid& Oid::append ( oid subIdentifier )
+{
+
+	oid * subIdentifiers = reserve( m_oidSize + 1 );
+	subIdentifiers[m_oidSize++] = subIdentifier;
+	return *this;
+
+}
+
+Oid& Oid::append ( const Oid& suffix )
+{
+
+	const size_t length = suffix.size();
+	oid * subIdentifiers = reserve( m_oidSize + length );
+	std::copy( suffix.data(), suffix.data() + length, subIdentifiers + m_oidSize );
+	m_oidSize += length;
+	return *this;
 
 }
 
-void Oid::printOidFromVector()
+bool Oid::isPrefixOf ( const Oid& other ) const
+{
+
+	return m_oidSize <= other.m_oidSize && std::equal( data(), data() + m_oidSize, other.data() );
+
+}
+
+int Oid::compare ( const Oid& other ) const
+{
+
+	const size_t common = std::min( m_oidSize, other.m_oidSize );
+	const oid * lhs = data();
+	const oid * rhs = other.data();
+
+	for ( size_t i = 0; i < common; i++ )
+	{
+		if ( lhs[i] != rhs[i] )
+			return lhs[i] < rhs[i] ? -1 : 1;
+	}
+
+	if ( m_oidSize == other.m_oidSize )
+		return 0;
+	return m_oidSize < other.m_oidSize ? -1 : 1;
+
+}
+
+std::string Oid::getOidString() const
+{
+
+	std::string oidString;
+	oidString.reserve( m_oidSize * 4 );
+
+	const oid * subIdentifiers = data();
+	for ( size_t i = 0; i < m_oidSize; i++ )
+	{
+		if ( i )
+			oidString += '.';
+		oidString += std::to_string( subIdentifiers[i] );
+	}
+	return oidString;
+
+}
+
+std::vector<std::string> Oid::getOidVector() const
+{
+
+	std::vector<std::string> oidVector;
+	oidVector.reserve( m_oidSize );
+
+	const oid * subIdentifiers = data();
+	for ( size_t i = 0; i < m_oidSize; i++ )
+		oidVector.push_back( std::to_string( subIdentifiers[i] ) );
+	return oidVector;
+
+}
+
+void Oid::printOidFromVector() const
 {
 	
-	LOG(Log::INF, LogComponentLevels::mule()) << mule::containerToString(m_oidVector, ".");
+	LOG(Log::INF, LogComponentLevels::mule()) << getOidString();
 
 }
 
+std::ostream& Snmp::operator<<( std::ostream& stream, const Oid& oidOfInterest )
+{
+
+	return stream << oidOfInterest.getOidString();
+
+}
@@ -0,0 +1,97 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <OidCache.h>
+#include <SnmpExceptions.h>
+#include <MuleLogComponents.h>
+
+#include <mutex>
+
+using Mule::LogComponentLevels;
+
+namespace Snmp
+{
+
+OidCache& OidCache::instance()
+{
+
+	static OidCache cache;
+	return cache;
+
+}
+
+Oid OidCache::get( const std::string& oidOfInterest )
+{
+
+	{
+		std::shared_lock<std::shared_mutex> guard(m_mutex);
+		auto cached = m_oids.find( oidOfInterest );
+		if ( cached != m_oids.end() )
+			return cached->second;
+	}
+
+	LOG(Log::TRC, LogComponentLevels::mule()) << "Preparing OID: " << oidOfInterest;
+
+	oid anOID[MAX_OID_LEN];
+	size_t anOID_len = MAX_OID_LEN;
+
+	if (! snmp_parse_oid(oidOfInterest.c_str(), anOID, &anOID_len))
+	{
+		  snmp_perror(oidOfInterest.c_str());
+		  snmp_throw_runtime_error_with_origin("Failed to parse OID");
+	}
+
+	const Oid parsedOid( anOID, anOID_len );
+
+	std::unique_lock<std::shared_mutex> guard(m_mutex);
+	if ( m_oids.size() < MAX_ENTRIES )
+		m_oids.emplace( oidOfInterest, parsedOid );
+
+	return parsedOid;
+
+}
+
+size_t OidCache::size() const
+{
+
+	std::shared_lock<std::shared_mutex> guard(m_mutex);
+	return m_oids.size();
+
+}
+
+void OidCache::clear()
+{
+
+	std::unique_lock<std::shared_mutex> guard(m_mutex);
+	m_oids.clear();
+
+}
+
+}
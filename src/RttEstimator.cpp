@@ -0,0 +1,109 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <RttEstimator.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace Snmp
+{
+
+/*
+ *	RFC 6298 gains: alpha = 1/8 and beta = 1/4. K = 4 weighs the variation in the timeout.
+ */
+static const int64_t RTT_ALPHA_DIVISOR = 8;
+static const int64_t RTT_BETA_DIVISOR = 4;
+static const int64_t RTT_VARIATION_FACTOR = 4;
+
+RttEstimator::RttEstimator( int initialTimeoutUs, const RttEstimatorOptions& options ) :
+				m_options(options)
+{
+
+	m_estimate.timeoutUs = clamp( initialTimeoutUs );
+
+}
+
+void RttEstimator::addSample( int64_t rttUs )
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+
+	if ( m_estimate.samples == 0 )
+	{
+		m_estimate.smoothedRttUs = rttUs;
+		m_estimate.rttVariationUs = rttUs / 2;
+	}
+	else
+	{
+		const int64_t error = rttUs - m_estimate.smoothedRttUs;
+		m_estimate.rttVariationUs += ( std::abs(error) - m_estimate.rttVariationUs ) / RTT_BETA_DIVISOR;
+		m_estimate.smoothedRttUs += error / RTT_ALPHA_DIVISOR;
+	}
+
+	m_estimate.samples++;
+	m_estimate.timeoutUs = clamp( m_estimate.smoothedRttUs + RTT_VARIATION_FACTOR * m_estimate.rttVariationUs );
+
+}
+
+void RttEstimator::onTimeout()
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+
+	m_estimate.timeouts++;
+	m_estimate.timeoutUs = clamp( 2 * m_estimate.timeoutUs );
+
+}
+
+int RttEstimator::timeoutUs() const
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	return static_cast<int>( m_estimate.timeoutUs );
+
+}
+
+RttEstimator::Estimate RttEstimator::getEstimate() const
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	return m_estimate;
+
+}
+
+int64_t RttEstimator::clamp( int64_t timeoutUs ) const
+{
+
+	return std::min<int64_t>( std::max<int64_t>( timeoutUs, m_options.floorUs ), m_options.ceilingUs );
+
+}
+
+} // Snmp
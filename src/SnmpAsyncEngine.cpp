@@ -0,0 +1,426 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <SnmpAsyncEngine.h>
+#include <SnmpExceptions.h>
+#include <MuleLogComponents.h>
+
+#include <cerrno>
+
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+using Mule::LogComponentLevels;
+
+namespace Snmp
+{
+
+/*
+ *	Granularity of the retransmission and deadline checks while requests are pending
+ */
+static const int ASYNC_TICK_MS = 10;
+
+SnmpAsyncEngine::SnmpAsyncEngine() :
+				m_pendingCount(0),
+				m_running(true)
+{
+
+	if ( pipe(m_wakeUpPipe) != 0 )
+		snmp_throw_runtime_error_with_origin("Failed to create the wake up pipe of the asynchronous engine");
+
+	fcntl( m_wakeUpPipe[0], F_SETFL, O_NONBLOCK );
+	fcntl( m_wakeUpPipe[1], F_SETFL, O_NONBLOCK );
+
+	m_thread = std::thread( &SnmpAsyncEngine::eventLoop, this );
+
+}
+
+SnmpAsyncEngine::~SnmpAsyncEngine()
+{
+
+	m_running = false;
+	wakeUp();
+	m_thread.join();
+
+	// Fail whatever was not sent or answered yet
+	for ( auto& submission : m_submissions )
+		invokeCallback( submission.callback, Snmp_BadCommunicationError, nullptr );
+	std::map<SnmpBackend*, void*> sessions;
+	sessions.swap( m_sessions );
+	for ( auto& session : sessions )
+	{
+		failSession( session.second );
+		snmp_sess_close( session.second );
+	}
+	for ( void * sessp : m_closedSessions )
+		snmp_sess_close( sessp );
+	for ( auto& detachRequest : m_detachRequests )
+		detachRequest.second.set_value();
+
+	close( m_wakeUpPipe[0] );
+	close( m_wakeUpPipe[1] );
+
+}
+
+void SnmpAsyncEngine::asyncSend( SnmpBackend& backend, PduPtr pdu, Callback callback, int timeoutUs )
+{
+
+	{
+		std::lock_guard<std::mutex> guard(m_submissionMutex);
+		m_submissions.push_back( Submission{ &backend, std::move(pdu), std::move(callback), timeoutUs } );
+	}
+	wakeUp();
+
+}
+
+void SnmpAsyncEngine::asyncGet( SnmpBackend& backend, const std::vector<std::string>& oidsOfInterest, Callback callback, int timeoutUs )
+{
+
+	LOG(Log::TRC, LogComponentLevels::mule()) << "SNMP async get of " << oidsOfInterest.size() << " OIDs on device with hostname: " << backend.getHostName();
+
+	PduPtr pdu( snmp_pdu_create(SNMP_MSG_GET) );
+
+	for ( const auto& oidOfInterest : oidsOfInterest )
+	{
+		const Oid subIdentifierList = backend.prepareOid( oidOfInterest );
+		snmp_add_null_var( pdu.get(), subIdentifierList.data(), subIdentifierList.size() );
+	}
+
+	asyncSend( backend, std::move(pdu), std::move(callback), timeoutUs );
+
+}
+
+std::future<std::pair<SnmpStatus, PduPtr>> SnmpAsyncEngine::asyncGet( SnmpBackend& backend, const std::vector<std::string>& oidsOfInterest, int timeoutUs )
+{
+
+	auto promise = std::make_shared<std::promise<std::pair<SnmpStatus, PduPtr>>>();
+	auto future = promise->get_future();
+
+	asyncGet( backend, oidsOfInterest, [promise] ( SnmpStatus status, PduPtr response ) {
+		promise->set_value( std::make_pair( status, std::move(response) ) );
+	}, timeoutUs );
+
+	return future;
+
+}
+
+void SnmpAsyncEngine::detach( SnmpBackend& backend )
+{
+
+	// From a callback the loop would wait for itself, detach right away instead
+	if ( std::this_thread::get_id() == m_thread.get_id() )
+	{
+		detachSession( &backend );
+		return;
+	}
+
+	std::future<void> detached;
+	{
+		std::lock_guard<std::mutex> guard(m_submissionMutex);
+		m_detachRequests.emplace_back( &backend, std::promise<void>() );
+		detached = m_detachRequests.back().second.get_future();
+	}
+	wakeUp();
+	detached.wait();
+
+}
+
+void SnmpAsyncEngine::wakeUp()
+{
+
+	const char byte = 0;
+	// A full pipe already guarantees a wake up, nothing to do on failure
+	if ( write( m_wakeUpPipe[1], &byte, 1 ) < 0 ) {}
+
+}
+
+void SnmpAsyncEngine::eventLoop()
+{
+
+	LOG(Log::INF, LogComponentLevels::mule()) << "SNMP asynchronous engine started";
+
+	std::vector<pollfd> pollFds;
+	std::vector<void*> pollSessions;
+
+	while ( m_running )
+	{
+
+		processDetachRequests();
+		processSubmissions();
+
+		pollFds.clear();
+		pollSessions.clear();
+		pollFds.push_back( pollfd{ m_wakeUpPipe[0], POLLIN, 0 } );
+		pollSessions.push_back( nullptr );
+		for ( const auto& session : m_sessions )
+		{
+			netsnmp_transport *transport = snmp_sess_transport( session.second );
+			if ( !transport )
+				continue;
+			pollFds.push_back( pollfd{ transport->sock, POLLIN, 0 } );
+			pollSessions.push_back( session.second );
+		}
+
+		const int timeoutMs = m_pending.empty() ? -1 : ASYNC_TICK_MS;
+		if ( poll( pollFds.data(), pollFds.size(), timeoutMs ) < 0 && errno != EINTR )
+		{
+			LOG(Log::ERR, LogComponentLevels::mule()) << "SNMP asynchronous engine poll failed, errno: " << errno;
+			std::this_thread::sleep_for( std::chrono::milliseconds(ASYNC_TICK_MS) );
+			continue;
+		}
+
+		if ( pollFds[0].revents & POLLIN )
+		{
+			char buffer[64];
+			while ( read( m_wakeUpPipe[0], buffer, sizeof buffer ) > 0 ) {}
+		}
+
+		for ( size_t i = 1; i < pollFds.size(); i++ )
+		{
+			if ( !(pollFds[i].revents & (POLLIN | POLLERR | POLLHUP)) )
+				continue;
+
+			netsnmp_large_fd_set readFds;
+			netsnmp_large_fd_set_init( &readFds, pollFds[i].fd + 1 );
+			NETSNMP_LARGE_FD_SET( pollFds[i].fd, &readFds );
+			snmp_sess_read2( pollSessions[i], &readFds );
+			netsnmp_large_fd_set_cleanup( &readFds );
+		}
+
+		// Retransmissions and session level timeouts
+		if ( !m_pending.empty() )
+			for ( void * sessp : pollSessions )
+				if ( sessp )
+					snmp_sess_timeout( sessp );
+
+		expireRequests();
+
+		// Sessions detached by callbacks of this iteration
+		for ( void * sessp : m_closedSessions )
+			snmp_sess_close( sessp );
+		m_closedSessions.clear();
+
+	}
+
+	LOG(Log::INF, LogComponentLevels::mule()) << "SNMP asynchronous engine stopped";
+
+}
+
+void SnmpAsyncEngine::processSubmissions()
+{
+
+	std::deque<Submission> submissions;
+	{
+		std::lock_guard<std::mutex> guard(m_submissionMutex);
+		submissions.swap( m_submissions );
+	}
+
+	for ( auto& submission : submissions )
+	{
+
+		void * sessp = sessionFor( *submission.backend );
+		if ( !sessp )
+		{
+			invokeCallback( submission.callback, Snmp_BadCommunicationError, nullptr );
+			continue;
+		}
+
+		// The library copies the session timeout into each request when sending it and gives up
+		// after the session retries, so spread the deadline over the attempts to stop retransmitting
+		// once the request expired
+		netsnmp_session * session = snmp_sess_session( sessp );
+		const long attempts = session->retries + 1;
+		session->timeout = std::max( 1L, std::min( submission.backend->m_snmpSession.timeout, submission.timeoutUs / attempts ) );
+
+		netsnmp_pdu * pdu = submission.pdu.release();
+		const int reqid = snmp_sess_async_send( sessp, pdu, &SnmpAsyncEngine::responseCallback, this );
+		if ( reqid == 0 )
+		{
+			LOG(Log::ERR, LogComponentLevels::mule()) << "Failed to send asynchronous request to: " << submission.backend->getHostName();
+			snmp_free_pdu( pdu );
+			invokeCallback( submission.callback, Snmp_BadCommunicationError, nullptr );
+			continue;
+		}
+
+		m_pending[reqid] = PendingRequest{ sessp, std::move(submission.callback),
+			std::chrono::steady_clock::now() + std::chrono::microseconds(submission.timeoutUs) };
+		m_pendingCount = m_pending.size();
+
+	}
+
+}
+
+void SnmpAsyncEngine::processDetachRequests()
+{
+
+	std::deque<std::pair<SnmpBackend*, std::promise<void>>> detachRequests;
+	{
+		std::lock_guard<std::mutex> guard(m_submissionMutex);
+		detachRequests.swap( m_detachRequests );
+	}
+
+	for ( auto& detachRequest : detachRequests )
+	{
+		detachSession( detachRequest.first );
+		detachRequest.second.set_value();
+	}
+
+}
+
+void SnmpAsyncEngine::detachSession( SnmpBackend* backend )
+{
+
+	auto session = m_sessions.find( backend );
+	if ( session == m_sessions.end() )
+		return;
+
+	// Erased first, as the callbacks of the failed requests may detach or send again
+	void * sessp = session->second;
+	m_sessions.erase( session );
+	failSession( sessp );
+
+	// A callback may run inside the library on this very session, close it once back in the loop
+	if ( std::this_thread::get_id() == m_thread.get_id() && m_running )
+		m_closedSessions.push_back( sessp );
+	else
+		snmp_sess_close( sessp );
+
+}
+
+void SnmpAsyncEngine::expireRequests()
+{
+
+	const auto now = std::chrono::steady_clock::now();
+
+	std::vector<int> expired;
+	for ( const auto& request : m_pending )
+		if ( request.second.deadline <= now )
+			expired.push_back( request.first );
+
+	for ( const int reqid : expired )
+	{
+		LOG(Log::TRC, LogComponentLevels::mule()) << "Asynchronous request " << reqid << " timed out";
+		completeRequest( reqid, Snmp_BadTimeout, nullptr );
+	}
+
+}
+
+void SnmpAsyncEngine::completeRequest( int reqid, SnmpStatus status, PduPtr response )
+{
+
+	auto request = m_pending.find( reqid );
+
+	// Already completed, e.g. the response of a request which met its deadline before
+	if ( request == m_pending.end() )
+		return;
+
+	Callback callback = std::move( request->second.callback );
+	m_pending.erase( request );
+	m_pendingCount = m_pending.size();
+
+	invokeCallback( callback, status, std::move(response) );
+
+}
+
+void SnmpAsyncEngine::invokeCallback( Callback& callback, SnmpStatus status, PduPtr response )
+{
+
+	// A throwing callback must not take the loop thread down
+	try
+	{
+		callback( status, std::move(response) );
+	}
+	catch (const std::exception& e)
+	{
+		LOG(Log::ERR, LogComponentLevels::mule()) << "Asynchronous request callback threw: " << e.what();
+	}
+
+}
+
+void SnmpAsyncEngine::failSession( void * sessp )
+{
+
+	std::vector<int> orphans;
+	for ( const auto& request : m_pending )
+		if ( request.second.sessp == sessp )
+			orphans.push_back( request.first );
+
+	for ( const int reqid : orphans )
+		completeRequest( reqid, Snmp_BadCommunicationError, nullptr );
+
+}
+
+void * SnmpAsyncEngine::sessionFor( SnmpBackend& backend )
+{
+
+	auto session = m_sessions.find( &backend );
+	if ( session != m_sessions.end() )
+		return session->second;
+
+	LOG(Log::INF, LogComponentLevels::mule()) << "[" << backend.getHostName() << "] " << "Opening asynchronous session";
+
+	void * sessp = snmp_sess_open( &backend.m_snmpSession );
+	if ( !sessp )
+	{
+		snmp_perror("ack");
+		LOG(Log::ERR, LogComponentLevels::mule()) << "Failed to open asynchronous session to: " << backend.getHostName();
+		return nullptr;
+	}
+
+	m_sessions[&backend] = sessp;
+	return sessp;
+
+}
+
+int SnmpAsyncEngine::responseCallback( int operation, netsnmp_session * /*session*/, int reqid, netsnmp_pdu *pdu, void *magic )
+{
+
+	SnmpAsyncEngine * engine = static_cast<SnmpAsyncEngine*>( magic );
+
+	switch ( operation )
+	{
+		case NETSNMP_CALLBACK_OP_RECEIVED_MESSAGE:
+			// The library frees the PDU once we return
+			engine->completeRequest( reqid, pdu->errstat == SNMP_ERR_NOERROR ? Snmp_Good : Snmp_Bad, PduPtr( snmp_clone_pdu(pdu) ) );
+			break;
+		case NETSNMP_CALLBACK_OP_TIMED_OUT:
+			engine->completeRequest( reqid, Snmp_BadTimeout, nullptr );
+			break;
+		default:
+			engine->completeRequest( reqid, Snmp_BadCommunicationError, nullptr );
+			break;
+	}
+
+	return 1;
+
+}
+
+}
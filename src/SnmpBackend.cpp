@@ -29,15 +29,31 @@
  */
 
 #include <SnmpBackend.h>
+#include <OidCache.h>
+#include <SnmpLibrary.h>
+#include <UsmKeyCache.h>
 #include <SnmpExceptions.h>
 #include <SnmpDefinitions.h>
 #include <MuleLogComponents.h>
 
+#include <algorithm>
+#include <chrono>
+
 using Mule::LogComponentLevels;
 
 namespace Snmp
 {
 
+/*
+ *	Status of a request refused by the circuit breaker, next to net-snmp's STAT_* codes
+ */
+static const int STAT_CIRCUIT_OPEN = -1;
+
+/*
+ *	m_traceDevice of a backend not traced yet
+ */
+static const uint32_t UNREGISTERED_TRACE_DEVICE = UINT32_MAX;
+
 SnmpBackend::SnmpBackend(const std::string& hostname,
 				const std::string& snmpVersion,
 				const std::string& community,
@@ -67,15 +83,15 @@ SnmpBackend::SnmpBackend(const std::string& hostname,
 				m_privacyProtocol(privacyProtocol),
 				m_privacyPassPhrase(privacyPassPhrase),
 				m_snmpMaxRetries(snmpMaxRetries),
-				m_snmpTimeoutUs(snmpTimeoutUs)
+				m_snmpTimeoutUs(snmpTimeoutUs),
+				m_maxVarbindsPerPdu(Snmp::Constants::SNMP_MAX_VARBINDS_PER_PDU),
+				m_maxSetVarbindsPerPdu(Snmp::Constants::SNMP_MAX_VARBINDS_PER_PDU),
+				m_traceDevice(UNREGISTERED_TRACE_DEVICE)
 {
 
 	try
 	{
-		const auto envMIBS = getenv("MIBS");
-		const auto envMIBDIRS = getenv("MIBDIRS");
-		LOG(Log::INF, LogComponentLevels::mule()) << __FUNCTION__ << " calling init_snmp with $env:MIBS ["<<( envMIBS? envMIBS : "NULL" )<<"] $env.MIBDIRS ["<<( envMIBDIRS? envMIBDIRS : "NULL" )<<"]";
-		init_snmp("mule");
+		SnmpLibrary::initialize();
 		( m_snmpVersion == "3" ) ? m_snmpSession = createSessionV3() : m_snmpSession = createSessionV2();
 
 		/*
@@ -157,13 +173,21 @@ snmp_session SnmpBackend::createSessionV3 ()
 	LOG(Log::INF, LogComponentLevels::mule()) << "[" << m_hostname << "] " << "Setting security level to ["<<m_securityLevel<<"]";
 	snmpSession.securityLevel = securityLevelToInt(m_securityLevel);
 
-	auto generateSecurityKey = [] (const std::string& type, const oid* protocol, const size_t protocolLength, const char* passphrase, u_char* keyDestination, size_t* keyLength) {
-		if (generate_Ku(protocol, protocolLength, (u_char *) passphrase, strlen(passphrase), keyDestination, keyLength) != SNMPERR_SUCCESS)
+	auto generateSecurityKey = [] (const std::string& type, const oid* protocol, const size_t protocolLength, const std::string& passphrase, u_char* keyDestination, size_t* keyLength) {
+		std::vector<u_char> key;
+		try
+		{
+			// Shared by all the sessions using the same credentials
+			key = UsmKeyCache::instance().getKu( protocol, protocolLength, passphrase );
+		}
+		catch (const std::exception& e)
 		{
-			snmp_perror("mule");
-			snmp_log(LOG_ERR, "Error generating Ku from %s pass phrase. \n", type.c_str());
-			std::exit(EXIT_FAILURE);
+			snmp_throw_runtime_error_with_origin("Error generating Ku from " + type + " pass phrase: " + e.what());
 		}
+		if ( key.size() > *keyLength )
+			snmp_throw_runtime_error_with_origin("Ku generated from " + type + " pass phrase does not fit the session");
+		std::copy( key.begin(), key.end(), keyDestination );
+		*keyLength = key.size();
 		LOG(Log::INF, LogComponentLevels::mule()) << "Generated Ku for type ["<<type<<"], key length ["<<*keyLength<<"]";
 	};
 
@@ -177,7 +201,7 @@ snmp_session SnmpBackend::createSessionV3 ()
 		snmpSession.securityAuthKeyLen = USM_AUTH_KU_LEN;
 
 		generateSecurityKey("authentication", snmpSession.securityAuthProto, snmpSession.securityAuthProtoLen,
-			m_authenticationPassPhrase.c_str(),
+			m_authenticationPassPhrase,
 			snmpSession.securityAuthKey, &snmpSession.securityAuthKeyLen);
 	}
 
@@ -192,7 +216,7 @@ snmp_session SnmpBackend::createSessionV3 ()
 		snmpSession.securityPrivKeyLen = USM_PRIV_KU_LEN;
 
 		generateSecurityKey("privacy", snmpSession.securityAuthProto, snmpSession.securityAuthProtoLen, // AuthProto - I know, internet says so.
-			m_privacyPassPhrase.c_str(),
+			m_privacyPassPhrase,
 			snmpSession.securityPrivKey, &snmpSession.securityPrivKeyLen);
 	}
 
@@ -203,22 +227,21 @@ snmp_session SnmpBackend::createSessionV3 ()
 void SnmpBackend::openSession ( snmp_session snmpSession )
 {
 
-	SOCK_STARTUP;
-
 	try
 	{
-		m_sessp = snmp_sess_open(&snmpSession);
-		m_snmpSessionHandle = snmp_sess_session( m_sessp );
+		void * sessp = snmp_sess_open(&snmpSession);
+		m_snmpSessionHandle = sessp ? snmp_sess_session( sessp ) : nullptr;
 
 		if ( !m_snmpSessionHandle ) {
 			snmp_perror("ack");
 			snmp_throw_runtime_error_with_origin("When trying to open SNMP session to " + getHostName());
 		}
+
+		m_sessionPool.add( sessp );
 	}
 	catch (const std::exception& e)
 	{
 		LOG(Log::ERR, LogComponentLevels::mule()) << "Failed to establish communication: " << e.what();
-		SOCK_CLEANUP;
 		throw;
 	}
 
@@ -227,82 +250,193 @@ void SnmpBackend::openSession ( snmp_session snmpSession )
 void SnmpBackend::closeSession ()
 {
 
-	snmp_sess_close( m_sessp );
-	SOCK_CLEANUP;
+	m_sessionPool.closeAll();
 
 }
 
-std::vector<Oid> SnmpBackend::snmpDeviceWalk ( const std::string& seedOid )
+void SnmpBackend::setSessionPoolSize( size_t sessions )
 {
 
-	LOG(Log::INF, LogComponentLevels::mule()) << "SNMP device walk seed OID:" << seedOid << " from: " << getHostName();
+	LOG(Log::INF, LogComponentLevels::mule()) << "[" << m_hostname << "] " << "Session pool of " << sessions << " sessions";
+
+	while ( m_sessionPool.size() < sessions )
+		openSession( m_snmpSession );
+
+}
 
-	netsnmp_variable_list *vars;
-	netsnmp_pdu * response = snmpGetNext ( seedOid );
+std::vector<Oid> SnmpBackend::snmpDeviceWalk ( const std::string& seedOid, long maxRepetitions )
+{
+
+	LOG(Log::INF, LogComponentLevels::mule()) << "SNMP device walk seed OID:" << seedOid << " from: " << getHostName();
 
-	Snmp::Oid currentDeviceOid( seedOid );
-	Snmp::Oid nextDeviceOid( seedOid );
+	Snmp::Oid currentDeviceOid = prepareOid( seedOid );
 
 	std::vector<Oid> walkedOids;
 
-	while (  true  )
+	walkVarbinds( currentDeviceOid, maxRepetitions, [&] ( const Oid& nextDeviceOid, const netsnmp_variable_list * vars ) {
+		if ( isEndOfWalk( currentDeviceOid, nextDeviceOid, vars ) )
+			return false;
+		walkedOids.push_back( nextDeviceOid );
+		currentDeviceOid = nextDeviceOid;
+		return true;
+	});
+
+	LOG(Log::INF, LogComponentLevels::mule()) << "SNMP walk reached its end";
+
+	return walkedOids;
+}
+
+size_t SnmpBackend::snmpWalk ( const std::string& rootOid, const WalkVisitor& visitor, long maxRepetitions )
+{
+
+	return snmpWalk( prepareOid( rootOid ), visitor, maxRepetitions );
+
+}
+
+size_t SnmpBackend::snmpWalk ( const Oid& rootOid, const WalkVisitor& visitor, long maxRepetitions )
+{
+
+	LOG(Log::DBG, LogComponentLevels::mule()) << "SNMP walk of subtree:" << rootOid << " from: " << getHostName();
+
+	size_t visited = 0;
+
+	walkVarbinds( rootOid, maxRepetitions, [&] ( const Oid& walkedOid, const netsnmp_variable_list * vars ) {
+		// Left the subtree
+		if ( !rootOid.isPrefixOf( walkedOid ) )
+			return false;
+		const auto value = decodeVariable( vars );
+		visited++;
+		return visitor( walkedOid, value.first, value.second );
+	});
+
+	LOG(Log::DBG, LogComponentLevels::mule()) << "SNMP walk of subtree:" << rootOid << " visited " << visited << " varbinds";
+
+	return visited;
+}
+
+void SnmpBackend::walkVarbinds ( const Oid& seedOid, long maxRepetitions, const VarbindVisitor& visit )
+{
+
+	// GETBULK does not exist in SNMPv1
+	if ( m_snmpVersion == "1" )
+		maxRepetitions = 0;
+
+	Snmp::Oid previousOid = seedOid;
+	Snmp::Oid walkedOid;
+
+	while ( true )
 	{
 
-        if (response)
-	    {
-	 		for(vars = response->variables; vars; vars = vars->next_variable)
-	 		{
-	 			currentDeviceOid = nextDeviceOid;
-	 			nextDeviceOid(oidToString(vars->name, vars->name_length, vars));
-	 		}
+		// Only the PDU in flight is kept, every request continues from the last OID received
+		PduPtr response = walkRequest( previousOid, maxRepetitions );
 
-	 		snmp_free_pdu(response);
+		if ( !response || !response->variables )
+			return;
 
-			// Test criteria to break the walking loop
-			LOG(Log::TRC, LogComponentLevels::mule()) << "Current OID: " << currentDeviceOid.getOidString();
-			LOG(Log::TRC, LogComponentLevels::mule()) << "Next OID: " << nextDeviceOid.getOidString();
+		for( netsnmp_variable_list *vars = response->variables; vars; vars = vars->next_variable )
+		{
+			// Stop walking at the end of the agent's MIB view
+			if ( vars->type == SNMP_ENDOFMIBVIEW )
+				return;
 
-			// Stop walking due to level change
-			if ( currentDeviceOid.getOidVector()[currentDeviceOid.getOidSize() - 2] != nextDeviceOid.getOidVector()[nextDeviceOid.getOidSize() - 2] )
-			{
-			 	LOG(Log::INF, LogComponentLevels::mule()) << "SNMP walk reached its end";
-				break;
-			}
+			walkedOid.assign( vars->name, vars->name_length );
 
-			// Stop walking due size change
-			if ( currentDeviceOid.getOidSize() != nextDeviceOid.getOidSize() )
+			// An agent not answering in lexicographic order would be walked forever
+			if ( walkedOid.compare( previousOid ) <= 0 )
 			{
-			 	LOG(Log::INF, LogComponentLevels::mule()) << "SNMP walk reached its end";
-				break;
+				LOG(Log::WRN, LogComponentLevels::mule()) << "[" << m_hostname << "] " << "OID not increasing during walk: " << walkedOid << " after " << previousOid;
+				return;
 			}
 
-	 		walkedOids.push_back(nextDeviceOid);
+			if ( !visit( walkedOid, vars ) )
+				return;
 
-            response = snmpGetNext ( nextDeviceOid.getOidString() );
+			previousOid = walkedOid;
+		}
 
-	    }
+		SnmpTracer::instance().mark( SnmpTracer::Phase::Decoded );
 
 	}
 
- 	return walkedOids;
+}
+
+PduPtr SnmpBackend::walkRequest ( const Oid& oidOfInterest, long maxRepetitions )
+{
+
+	netsnmp_pdu *pdu = snmp_pdu_create( maxRepetitions > 0 ? SNMP_MSG_GETBULK : SNMP_MSG_GETNEXT );
+	if ( maxRepetitions > 0 )
+	{
+		pdu->non_repeaters = 0;
+		pdu->max_repetitions = maxRepetitions;
+	}
+
+	snmp_add_null_var( pdu, oidOfInterest.data(), oidOfInterest.size() );
+
+	netsnmp_pdu *rawResponse = nullptr;
+	const int snmp_status = synchResponse( pdu, &rawResponse );
+	PduPtr response( rawResponse );
+
+	// SNMPv1 agents answer noSuchName past the last OID of their MIB view
+	if ( snmp_status == STAT_SUCCESS && response->errstat == SNMP_ERR_NOSUCHNAME && m_snmpVersion == "1" )
+		return nullptr;
+
+	try
+	{
+		throwIfSnmpResponseError( snmp_status, response.get() );
+	}
+	catch (const std::exception& e)
+	{
+		LOG(Log::ERR, LogComponentLevels::mule()) << "At walk OID:" << oidOfInterest << " from: " << getHostName() << " ." << e.what();
+		throw;
+	}
+
+	return response;
+}
+
+bool SnmpBackend::isEndOfWalk ( const Oid& currentDeviceOid, const Oid& nextDeviceOid, const netsnmp_variable_list * vars )
+{
+
+	// Test criteria to break the walking loop
+	LOG(Log::TRC, LogComponentLevels::mule()) << "Current OID: " << currentDeviceOid.getOidString();
+	LOG(Log::TRC, LogComponentLevels::mule()) << "Next OID: " << nextDeviceOid.getOidString();
+
+	// Stop walking at the end of the agent's MIB view
+	if ( vars->type == SNMP_ENDOFMIBVIEW )
+		return true;
+
+	// Stop walking due size change
+	if ( currentDeviceOid.getOidSize() != nextDeviceOid.getOidSize() || nextDeviceOid.getOidSize() < 2 )
+		return true;
+
+	// Stop walking due to level change
+	if ( currentDeviceOid[currentDeviceOid.getOidSize() - 2] != nextDeviceOid[nextDeviceOid.getOidSize() - 2] )
+		return true;
+
+	return false;
+
 }
 
 PduPtr SnmpBackend::snmpGet( const std::string& oidOfInterest )
+{
+
+	return snmpGet( prepareOid( oidOfInterest ) );
+
+}
+
+PduPtr SnmpBackend::snmpGet( const Oid& oidOfInterest )
 {
 
 	LOG(Log::TRC, LogComponentLevels::mule()) << "SNMP get OID:" << oidOfInterest << " on device with hostname: " << m_hostname;
 
 	netsnmp_pdu *pdu = snmp_pdu_create(SNMP_MSG_GET);
 
-	std::vector<oid> subIdentifierList = prepareOid( oidOfInterest );
-
 	/*
 	 * snmp_add_null_var is a convenience function to add an empty varbind to the PDU. Without
      * needing to specify the NULL value explicitly. This is the normal mechanism for
      * constructing a GET (or similar) information retrieval request.
      * Again, this returns a pointer to the new varbind, or NULL.
 	 */
-	snmp_add_null_var( pdu, &subIdentifierList[0], subIdentifierList.size() );
+	snmp_add_null_var( pdu, oidOfInterest.data(), oidOfInterest.size() );
 
 	/*
 	 * Send the Request out.
@@ -313,8 +447,7 @@ PduPtr SnmpBackend::snmpGet( const std::string& oidOfInterest )
 	netsnmp_pdu *response = nullptr;
 	try
 	{
-		std::lock_guard<std::mutex> guard(m_mutex);
-		int snmp_status = snmp_sess_synch_response( m_sessp, pdu, &response );
+		int snmp_status = synchResponse( pdu, &response );
 		throwIfSnmpResponseError( snmp_status, response );
 	}
 	catch (const std::exception& e)
@@ -326,25 +459,262 @@ PduPtr SnmpBackend::snmpGet( const std::string& oidOfInterest )
 	return PduPtr(response);
 }
 
+PduPtr SnmpBackend::trySnmpGet( const Oid& oidOfInterest, SnmpError& error )
+{
+
+	netsnmp_pdu *pdu = snmp_pdu_create(SNMP_MSG_GET);
+	snmp_add_null_var( pdu, oidOfInterest.data(), oidOfInterest.size() );
+
+	netsnmp_pdu *response = nullptr;
+	const int snmp_status = synchResponse( pdu, &response );
+	PduPtr responseGuard( response );
+
+	error = responseError( snmp_status, response );
+	if ( !error && !response->variables )
+		error = SnmpError::agent( SNMP_ERR_GENERR, 0 );
+	if ( !error && response->variables->type >= SNMP_NOSUCHOBJECT && response->variables->type <= SNMP_ENDOFMIBVIEW )
+		error = varbindError( response->variables );
+
+	if ( error )
+	{
+		LOG(Log::DBG, LogComponentLevels::mule()) << "[" << m_hostname << "] " << "Get OID:" << oidOfInterest << " failed, " << error.toString();
+		return PduPtr();
+	}
+
+	return responseGuard;
+
+}
+
+SnmpError SnmpBackend::trySnmpSet( const std::string& oidOfInterest, const snmpSetValue& value )
+{
+
+	Oid prepared;
+	SnmpError error;
+	if ( !tryPrepareOid( oidOfInterest, prepared, error ) )
+		return error;
+	return trySnmpSet( prepared, value );
+
+}
+
+SnmpError SnmpBackend::trySnmpSet( const Oid& oidOfInterest, const snmpSetValue& value )
+{
+
+	netsnmp_pdu *pdu = snmp_pdu_create(SNMP_MSG_SET);
+	if ( addSetVarbind( pdu, oidOfInterest, value ) != Snmp_Good )
+	{
+		snmp_free_pdu( pdu );
+		return SnmpError::of( SnmpError::Kind::WrongType );
+	}
+
+	netsnmp_pdu *response = nullptr;
+	const int snmp_status = synchResponse( pdu, &response );
+	PduPtr responseGuard( response );
+
+	const SnmpError error = responseError( snmp_status, response );
+	if ( error )
+		LOG(Log::DBG, LogComponentLevels::mule()) << "[" << m_hostname << "] " << "Set OID:" << oidOfInterest << " failed, " << error.toString();
+	return error;
+
+}
+
+bool SnmpBackend::tryPrepareOid ( const std::string& oidOfInterest, Oid& prepared, SnmpError& error )
+{
+
+	// Parse failures are configuration errors, rare enough for the exception of OidCache
+	try
+	{
+		prepared = prepareOid( oidOfInterest );
+		return true;
+	}
+	catch (const std::exception& e)
+	{
+		LOG(Log::DBG, LogComponentLevels::mule()) << "[" << m_hostname << "] " << e.what();
+		error = SnmpError::of( SnmpError::Kind::InvalidOid );
+		return false;
+	}
+
+}
+
+std::vector<std::pair<SnmpStatus, snmpGetValue>> SnmpBackend::snmpGetMany( const std::vector<std::string>& oidsOfInterest )
+{
+
+	LOG(Log::TRC, LogComponentLevels::mule()) << "SNMP get of " << oidsOfInterest.size() << " OIDs on device with hostname: " << m_hostname;
+
+	std::vector<std::pair<SnmpStatus, snmpGetValue>> results( oidsOfInterest.size(), {Snmp_Bad, std::monostate()} );
+	std::vector<Oid> subIdentifierLists( oidsOfInterest.size() );
+	std::vector<size_t> pending;
+	pending.reserve( oidsOfInterest.size() );
+
+	for ( size_t i = 0; i < oidsOfInterest.size(); i++ )
+	{
+		try
+		{
+			subIdentifierLists[i] = prepareOid( oidsOfInterest[i] );
+			pending.push_back(i);
+		}
+		catch (const std::exception& e)
+		{
+			LOG(Log::ERR, LogComponentLevels::mule()) << "At snmpGetMany OID:" << oidsOfInterest[i] << " from: " << getHostName() << " ." << e.what();
+		}
+	}
+
+	snmpGetPending( subIdentifierLists, pending, results );
+
+	return results;
+}
+
+std::vector<std::pair<SnmpStatus, snmpGetValue>> SnmpBackend::snmpGetMany( const std::vector<Oid>& oidsOfInterest )
+{
+
+	LOG(Log::TRC, LogComponentLevels::mule()) << "SNMP get of " << oidsOfInterest.size() << " OIDs on device with hostname: " << m_hostname;
+
+	std::vector<std::pair<SnmpStatus, snmpGetValue>> results( oidsOfInterest.size(), {Snmp_Bad, std::monostate()} );
+	std::vector<size_t> pending( oidsOfInterest.size() );
+	for ( size_t i = 0; i < pending.size(); i++ )
+		pending[i] = i;
+
+	snmpGetPending( oidsOfInterest, pending, results );
+
+	return results;
+}
+
+void SnmpBackend::snmpGetPending ( const std::vector<Oid>& subIdentifierLists,
+				const std::vector<size_t>& pending,
+				std::vector<std::pair<SnmpStatus, snmpGetValue>>& results )
+{
+
+	if ( isCircuitOpen() )
+	{
+		for ( const size_t index : pending )
+			results[index] = {Snmp_BadNoCommunication, std::monostate()};
+		return;
+	}
+
+	size_t first = 0;
+	while ( first < pending.size() )
+	{
+		const size_t batchSize = std::min<size_t>( m_maxVarbindsPerPdu, pending.size() - first );
+		std::vector<size_t> batch( pending.begin() + first, pending.begin() + first + batchSize );
+		first += batchSize;
+
+		// No point in sending the remaining batches to a device which does not answer
+		if ( !snmpGetBatch( subIdentifierLists, batch, results ) )
+			break;
+	}
+
+}
+
+bool SnmpBackend::snmpGetBatch ( const std::vector<Oid>& subIdentifierLists,
+				const std::vector<size_t>& indices,
+				std::vector<std::pair<SnmpStatus, snmpGetValue>>& results )
+{
+
+	netsnmp_pdu *pdu = snmp_pdu_create(SNMP_MSG_GET);
+
+	for ( const size_t index : indices )
+		snmp_add_null_var( pdu, subIdentifierLists[index].data(), subIdentifierLists[index].size() );
+
+	LOG(Log::TRC, LogComponentLevels::mule()) << "Sending request with " << indices.size() << " varbinds";
+
+	netsnmp_pdu *response = nullptr;
+	int snmp_status = synchResponse( pdu, &response );
+	PduPtr responseGuard( response );
+
+	if ( snmp_status == STAT_SUCCESS && response->errstat == SNMP_ERR_TOOBIG && indices.size() > 1 )
+	{
+		const size_t half = indices.size() / 2;
+		LOG(Log::DBG, LogComponentLevels::mule()) << "[" << m_hostname << "] " << "PDU with " << indices.size() << " varbinds is too big, splitting";
+
+		size_t expected = m_maxVarbindsPerPdu;
+		while ( expected > half && !m_maxVarbindsPerPdu.compare_exchange_weak( expected, half ) ) {}
+
+		const std::vector<size_t> lower( indices.begin(), indices.begin() + half );
+		const std::vector<size_t> upper( indices.begin() + half, indices.end() );
+		return snmpGetBatch( subIdentifierLists, lower, results ) && snmpGetBatch( subIdentifierLists, upper, results );
+	}
+
+	// SNMPv1 agents refuse the whole PDU when a single name is unknown, retry without it
+	if ( snmp_status == STAT_SUCCESS && response->errstat == SNMP_ERR_NOSUCHNAME &&
+		response->errindex >= 1 && static_cast<size_t>(response->errindex) <= indices.size() )
+	{
+		std::vector<size_t> remaining( indices );
+		results[ remaining[response->errindex - 1] ] = {Snmp_BadNoDataAvailable, std::monostate()};
+		remaining.erase( remaining.begin() + (response->errindex - 1) );
+		return remaining.empty() || snmpGetBatch( subIdentifierLists, remaining, results );
+	}
+
+	const SnmpError error = responseError( snmp_status, response );
+	if ( error )
+	{
+		LOG(Log::ERR, LogComponentLevels::mule()) << "At snmpGetMany from: " << getHostName() << " ." << error.toString();
+		for ( const size_t index : indices )
+			results[index] = {error.status(), std::monostate()};
+		return snmp_status == STAT_SUCCESS;
+	}
+
+	size_t position = 0;
+	for ( netsnmp_variable_list *vars = response->variables; vars && position < indices.size(); vars = vars->next_variable, position++ )
+		results[ indices[position] ] = decodeVariable( vars );
+	SnmpTracer::instance().mark( SnmpTracer::Phase::Decoded );
+
+	return true;
+}
+
 SnmpStatus SnmpBackend::snmpSet( const std::string& oidOfInterest, snmpSetValue & value )
+{
+
+	return snmpSet( prepareOid( oidOfInterest ), value );
+
+}
+
+SnmpStatus SnmpBackend::snmpSet( const Oid& oidOfInterest, snmpSetValue & value )
 {
 
 	LOG(Log::TRC, LogComponentLevels::mule()) << "SNMP set OID:" << oidOfInterest << " on device with hostname: " << m_hostname;
 
+	if ( isCircuitOpen() )
+		return Snmp_BadNoCommunication;
+
 	netsnmp_pdu *pdu;
 	netsnmp_pdu *response = nullptr;
 	SnmpStatus status = Snmp_BadNotImplemented;
 
 	pdu = snmp_pdu_create(SNMP_MSG_SET);
 
-	std::vector<oid> subIdentifierList = prepareOid( oidOfInterest );
+	if ( addSetVarbind( pdu, oidOfInterest, value ) != Snmp_Good )
+	{
+		snmp_free_pdu( pdu );
+		return Snmp_BadNotSupported;
+	}
+
+	LOG(Log::TRC, LogComponentLevels::mule()) << "Sending request";
+
+	try
+	{
+		int snmp_status = synchResponse( pdu, &response );
+		status = throwIfSnmpResponseError( snmp_status, response );
+	}
+	catch (const std::exception& e)
+	{
+		LOG(Log::ERR, LogComponentLevels::mule()) << "At snmpSet OID:" << oidOfInterest << " from: " << getHostName() << " ." << e.what();
+		if (response) snmp_free_pdu(response);
+		throw;
+	}
+
+	if (response) snmp_free_pdu(response);
+
+	return status;
+}
+
+SnmpStatus SnmpBackend::addSetVarbind ( netsnmp_pdu * pdu, const Oid& oidOfInterest, const snmpSetValue& value )
+{
 
 	if ( std::holds_alternative<std::string>(value) )
 	{
 
-		std::string valueString = std::get<std::string>(value);
+		const std::string& valueString = std::get<std::string>(value);
 
-		snmp_pdu_add_variable(pdu, &subIdentifierList[0], subIdentifierList.size(), ASN_OCTET_STR, valueString.c_str(), valueString.size() );
+		snmp_pdu_add_variable(pdu, oidOfInterest.data(), oidOfInterest.size(), ASN_OCTET_STR, valueString.c_str(), valueString.size() );
 
 	}
 	else if ( std::holds_alternative<int32_t>(value) )
@@ -353,7 +723,7 @@ SnmpStatus SnmpBackend::snmpSet( const std::string& oidOfInterest, snmpSetValue
 		int32_t valueInt = std::get<int32_t>(value);
 		const void * val = &valueInt;
 
-		snmp_pdu_add_variable(pdu, &subIdentifierList[0], subIdentifierList.size(), ASN_INTEGER, val, sizeof( valueInt ) );
+		snmp_pdu_add_variable(pdu, oidOfInterest.data(), oidOfInterest.size(), ASN_INTEGER, val, sizeof( valueInt ) );
 
 	}
 	else if ( std::holds_alternative<uint32_t>(value) )
@@ -362,7 +732,7 @@ SnmpStatus SnmpBackend::snmpSet( const std::string& oidOfInterest, snmpSetValue
 		uint32_t valueInt = std::get<uint32_t>(value);
 		const void * val = &valueInt;
 
-		snmp_pdu_add_variable(pdu, &subIdentifierList[0], subIdentifierList.size(), 'B' /* Needed by PDU server */, val, sizeof( valueInt ) );
+		snmp_pdu_add_variable(pdu, oidOfInterest.data(), oidOfInterest.size(), 'B' /* Needed by PDU server */, val, sizeof( valueInt ) );
 
 	}
 	else if ( std::holds_alternative<bool>(value) )
@@ -372,9 +742,54 @@ SnmpStatus SnmpBackend::snmpSet( const std::string& oidOfInterest, snmpSetValue
 		int valueToInt = valueBool ? 1 : 0;
 		const void * val = &valueToInt;
 
-		snmp_pdu_add_variable(pdu, &subIdentifierList[0], subIdentifierList.size(), ASN_INTEGER, val, sizeof( valueToInt ) );
+		snmp_pdu_add_variable(pdu, oidOfInterest.data(), oidOfInterest.size(), ASN_INTEGER, val, sizeof( valueToInt ) );
+
+	}
+	else if ( std::holds_alternative<uint64_t>(value) )
+	{
+
+		const uint64_t valueCounter = std::get<uint64_t>(value);
+		struct counter64 valueHighLow;
+		valueHighLow.high = valueCounter >> 32;
+		valueHighLow.low = valueCounter & 0xffffffff;
+
+		snmp_pdu_add_variable(pdu, oidOfInterest.data(), oidOfInterest.size(), ASN_COUNTER64, &valueHighLow, sizeof( valueHighLow ) );
+
+	}
+	else if ( std::holds_alternative<TimeTicks>(value) )
+	{
+
+		const uint32_t valueTicks = std::get<TimeTicks>(value).hundredths;
+
+		snmp_pdu_add_variable(pdu, oidOfInterest.data(), oidOfInterest.size(), ASN_TIMETICKS, &valueTicks, sizeof( valueTicks ) );
 
 	}
+	else if ( std::holds_alternative<IpAddress>(value) )
+	{
+
+		const IpAddress& valueAddress = std::get<IpAddress>(value);
+
+		snmp_pdu_add_variable(pdu, oidOfInterest.data(), oidOfInterest.size(), ASN_IPADDRESS, valueAddress.octets.data(), valueAddress.octets.size() );
+
+	}
+#ifdef NETSNMP_WITH_OPAQUE_SPECIAL_TYPES
+	else if ( std::holds_alternative<float>(value) )
+	{
+
+		const float valueFloat = std::get<float>(value);
+
+		snmp_pdu_add_variable(pdu, oidOfInterest.data(), oidOfInterest.size(), ASN_OPAQUE_FLOAT, &valueFloat, sizeof( valueFloat ) );
+
+	}
+	else if ( std::holds_alternative<double>(value) )
+	{
+
+		const double valueDouble = std::get<double>(value);
+
+		snmp_pdu_add_variable(pdu, oidOfInterest.data(), oidOfInterest.size(), ASN_OPAQUE_DOUBLE, &valueDouble, sizeof( valueDouble ) );
+
+	}
+#endif
 	else
 	{
 
@@ -383,77 +798,234 @@ SnmpStatus SnmpBackend::snmpSet( const std::string& oidOfInterest, snmpSetValue
 
 	}
 
+	return Snmp_Good;
+
+}
+
+netsnmp_pdu * SnmpBackend::snmpGetNext( const std::string& oidOfInterest )
+{
+
+	return snmpGetNext( prepareOid( oidOfInterest ) );
+
+}
+
+netsnmp_pdu * SnmpBackend::snmpGetNext( const Oid& oidOfInterest )
+{
+
+	LOG(Log::TRC, LogComponentLevels::mule()) << "SNMP get next OID:" << oidOfInterest.getOidString();
+
+	netsnmp_pdu *pdu, *response;
+
+	pdu = snmp_pdu_create(SNMP_MSG_GETNEXT);
+
+	snmp_add_null_var( pdu, oidOfInterest.data(), oidOfInterest.size() );
+
 	LOG(Log::TRC, LogComponentLevels::mule()) << "Sending request";
 
 	try
 	{
-		std::lock_guard<std::mutex> guard(m_mutex);
-		int snmp_status = snmp_sess_synch_response( m_sessp, pdu, &response );
-		status = throwIfSnmpResponseError( snmp_status, response );
+		int snmp_status = synchResponse( pdu, &response );
+		throwIfSnmpResponseError( snmp_status, response );
 	}
 	catch (const std::exception& e)
 	{
-		LOG(Log::ERR, LogComponentLevels::mule()) << "At snmpSet OID:" << oidOfInterest << " from: " << getHostName() << " ." << e.what();
-		if (response) snmp_free_pdu(response);
+        LOG(Log::ERR, LogComponentLevels::mule()) << "At snmpGetNext OID:" << oidOfInterest.getOidString() << " from: " << getHostName() << " ." << e.what();
 		throw;
 	}
 
-	if (response) snmp_free_pdu(response);
+	return response;
+}
+
+int SnmpBackend::synchResponse ( netsnmp_pdu *pdu, netsnmp_pdu **response )
+{
+
+	if ( m_circuitBreaker && !m_circuitBreaker->allowRequest() )
+	{
+		m_metrics.recordRejected();
+		snmp_free_pdu( pdu );
+		*response = nullptr;
+		return STAT_CIRCUIT_OPEN;
+	}
+
+	// Before sending, the library owns the request afterwards
+	m_metrics.recordRequest( pdu );
+
+	SnmpTracer& tracer = SnmpTracer::instance();
+	if ( tracer.isEnabled() )
+		tracer.enqueue( traceDevice() );
+
+	int status;
+	{
+		const auto waitStart = std::chrono::steady_clock::now();
+		SnmpSessionPool::Lease session = m_sessionPool.acquire();
+		const auto start = std::chrono::steady_clock::now();
+		m_metrics.recordSessionWait( std::chrono::duration_cast<std::chrono::microseconds>( start - waitStart ) );
+		tracer.mark( SnmpTracer::Phase::SessionAcquired );
+
+		if ( m_rttEstimator )
+			status = adaptiveSynchResponse( session.get(), pdu, response );
+		else
+			status = snmp_sess_synch_response( session.get(), pdu, response );
+		tracer.mark( SnmpTracer::Phase::Received );
+
+		m_metrics.recordResponse( status, *response, std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - start ) );
+	}
+
+	if ( m_circuitBreaker )
+		( status == STAT_SUCCESS ) ? m_circuitBreaker->onSuccess() : m_circuitBreaker->onFailure();
 
 	return status;
+
 }
 
-netsnmp_pdu * SnmpBackend::snmpGetNext( const std::string& oidOfInterest )
+int SnmpBackend::adaptiveSynchResponse ( void * sessp, netsnmp_pdu *pdu, netsnmp_pdu **response )
 {
 
-	LOG(Log::TRC, LogComponentLevels::mule()) << "SNMP get next OID:" << oidOfInterest;
+	/*
+	 *	Retransmissions are done here rather than by the library, so that each one gets the
+	 *	current timeout and only answers to first transmissions are sampled (Karn's rule)
+	 */
+	netsnmp_session * session = snmp_sess_session( sessp );
+	session->retries = 0;
 
-	netsnmp_pdu *pdu, *response;
+	for ( int attempt = 0; ; attempt++ )
+	{
 
-	pdu = snmp_pdu_create(SNMP_MSG_GETNEXT);
+		const bool lastAttempt = attempt >= m_snmpMaxRetries;
+
+		// The library consumes the request, keep a copy to retransmit
+		netsnmp_pdu * retransmission = lastAttempt ? nullptr : snmp_clone_pdu( pdu );
+
+		session->timeout = m_rttEstimator->timeoutUs();
+
+		const auto start = std::chrono::steady_clock::now();
+		const int status = snmp_sess_synch_response( sessp, pdu, response );
+
+		if ( status != STAT_TIMEOUT )
+		{
+			if ( status == STAT_SUCCESS && attempt == 0 )
+				m_rttEstimator->addSample( std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - start ).count() );
+			if ( retransmission )
+				snmp_free_pdu( retransmission );
+			return status;
+		}
+
+		m_rttEstimator->onTimeout();
+
+		if ( lastAttempt || !retransmission )
+			return status;
+
+		LOG(Log::DBG, LogComponentLevels::mule()) << "[" << m_hostname << "] " << "Timeout, retransmitting with timeout " << m_rttEstimator->timeoutUs() << " us";
+		pdu = retransmission;
+
+	}
+
+}
+
+void SnmpBackend::setAdaptiveTimeout( const RttEstimatorOptions& options )
+{
+
+	LOG(Log::INF, LogComponentLevels::mule()) << "[" << m_hostname << "] " << "Adaptive timeout between " << options.floorUs << " and " << options.ceilingUs << " us";
+
+	m_rttEstimator.reset( new RttEstimator( m_snmpTimeoutUs, options ) );
+
+}
+
+void SnmpBackend::setCircuitBreaker( const CircuitBreakerOptions& options, CircuitBreaker::StateListener listener )
+{
+
+	LOG(Log::INF, LogComponentLevels::mule()) << "[" << m_hostname << "] " << "Circuit breaker opening after " << options.failureThreshold << " failures";
+
+	const std::string hostname = m_hostname;
+	m_circuitBreaker.reset( new CircuitBreaker( options, [hostname, listener] ( CircuitBreaker::State from, CircuitBreaker::State to ) {
+		LOG( to == CircuitBreaker::State::Open ? Log::WRN : Log::INF, LogComponentLevels::mule()) << "[" << hostname << "] "
+			<< "Circuit " << CircuitBreaker::stateToString( from ) << " -> " << CircuitBreaker::stateToString( to );
+		if ( listener )
+			listener( from, to );
+	}));
+
+}
 
-	std::vector<oid> subIdentifierList = prepareOid( oidOfInterest );
+CircuitBreaker::State SnmpBackend::getCircuitState() const
+{
+
+	return m_circuitBreaker ? m_circuitBreaker->getState() : CircuitBreaker::State::Closed;
+
+}
+
+RttEstimator::Estimate SnmpBackend::getRttEstimate() const
+{
 
-	snmp_add_null_var( pdu, &subIdentifierList[0], subIdentifierList.size() );
+	if ( m_rttEstimator )
+		return m_rttEstimator->getEstimate();
+
+	RttEstimator::Estimate estimate;
+	estimate.timeoutUs = m_snmpTimeoutUs;
+	return estimate;
+
+}
+
+netsnmp_pdu * SnmpBackend::snmpGetBulk( const std::string& oidOfInterest, long maxRepetitions )
+{
+
+	return snmpGetBulk( prepareOid( oidOfInterest ), maxRepetitions );
+
+}
+
+netsnmp_pdu * SnmpBackend::snmpGetBulk( const Oid& oidOfInterest, long maxRepetitions )
+{
+
+	LOG(Log::TRC, LogComponentLevels::mule()) << "SNMP get bulk OID:" << oidOfInterest.getOidString() << " max repetitions: " << maxRepetitions;
+
+	netsnmp_pdu *pdu, *response = nullptr;
+
+	pdu = snmp_pdu_create(SNMP_MSG_GETBULK);
+	pdu->non_repeaters = 0;
+	pdu->max_repetitions = maxRepetitions;
+
+	snmp_add_null_var( pdu, oidOfInterest.data(), oidOfInterest.size() );
 
 	LOG(Log::TRC, LogComponentLevels::mule()) << "Sending request";
 
 	try
 	{
-		std::lock_guard<std::mutex> guard(m_mutex);
-		int snmp_status = snmp_sess_synch_response( m_sessp, pdu, &response );
+		int snmp_status = synchResponse( pdu, &response );
 		throwIfSnmpResponseError( snmp_status, response );
 	}
 	catch (const std::exception& e)
 	{
-        LOG(Log::ERR, LogComponentLevels::mule()) << "At snmpGetNext OID:" << oidOfInterest << " from: " << getHostName() << " ." << e.what();
+		LOG(Log::ERR, LogComponentLevels::mule()) << "At snmpGetBulk OID:" << oidOfInterest.getOidString() << " from: " << getHostName() << " ." << e.what();
+		if (response) snmp_free_pdu(response);
 		throw;
 	}
 
 	return response;
 }
 
-std::vector<oid> SnmpBackend::prepareOid ( const std::string& oidOfInterest )
+Oid SnmpBackend::prepareOid ( const std::string& oidOfInterest )
 {
 
-	LOG(Log::TRC, LogComponentLevels::mule()) << "Preparing OID: " << oidOfInterest;
+	SnmpTracer& tracer = SnmpTracer::instance();
+	if ( tracer.isEnabled() )
+		tracer.begin( traceDevice() );
+	Oid prepared = OidCache::instance().get( oidOfInterest );
+	tracer.mark( SnmpTracer::Phase::OidPrepared );
+	return prepared;
 
-	oid anOID[MAX_OID_LEN];
-	size_t anOID_len = MAX_OID_LEN;
+}
+
+uint32_t SnmpBackend::traceDevice()
+{
 
-	if (! snmp_parse_oid(oidOfInterest.c_str(), anOID, &anOID_len))
+	uint32_t device = m_traceDevice.load( std::memory_order_relaxed );
+	if ( device == UNREGISTERED_TRACE_DEVICE )
 	{
-		  snmp_perror(oidOfInterest.c_str());
-		  snmp_throw_runtime_error_with_origin("Failed to parse OID");
+		// Racing threads get the same number, registration goes by hostname
+		device = SnmpTracer::instance().registerDevice( m_hostname );
+		m_traceDevice.store( device, std::memory_order_relaxed );
 	}
+	return device;
 
-	std::vector<oid> subIdentifierList(anOID_len, 0);
-	subIdentifierList.shrink_to_fit();
-
-	for ( unsigned int i = 0; i<anOID_len; i++ )
-		subIdentifierList[i]=anOID[i];
-
-	return subIdentifierList;
 }
 
 SnmpStatus SnmpBackend::throwIfSnmpResponseError ( int status, netsnmp_pdu *response )
@@ -481,6 +1053,10 @@ SnmpStatus SnmpBackend::throwIfSnmpResponseError ( int status, netsnmp_pdu *resp
 		{
 			snmp_throw_runtime_error_with_origin( "Error due to STAT_TIMEOUT");
 		}
+		else if ( status == STAT_CIRCUIT_OPEN )
+		{
+			throw DeviceUnavailableException( "Device " + m_hostname + " is unavailable, circuit breaker open" );
+		}
 		else
 		{
 			snmp_throw_runtime_error_with_origin( "Unknown session error" );
@@ -490,6 +1066,38 @@ SnmpStatus SnmpBackend::throwIfSnmpResponseError ( int status, netsnmp_pdu *resp
 	return Snmp_Bad;
 }
 
+SnmpError SnmpBackend::responseError ( int status, const netsnmp_pdu *response ) const
+{
+
+	switch ( status )
+	{
+		case STAT_SUCCESS:
+			if ( response->errstat == SNMP_ERR_NOERROR )
+				return SnmpError();
+			return SnmpError::agent( response->errstat, response->errindex );
+		case STAT_TIMEOUT:
+			return SnmpError::of( SnmpError::Kind::Timeout );
+		case STAT_CIRCUIT_OPEN:
+			return SnmpError::of( SnmpError::Kind::CircuitOpen );
+		default:
+			return SnmpError::of( SnmpError::Kind::SendError );
+	}
+
+}
+
+SnmpError SnmpBackend::varbindError ( const netsnmp_variable_list * vars )
+{
+
+	switch ( vars->type )
+	{
+		case SNMP_NOSUCHOBJECT: return SnmpError::exceptionValue( Constants::NO_SUCH_OBJECT );
+		case SNMP_NOSUCHINSTANCE: return SnmpError::exceptionValue( Constants::NO_SUCH_INSTANCE );
+		case SNMP_ENDOFMIBVIEW: return SnmpError::exceptionValue( Constants::END_OF_MIB_VIEW );
+		default: return SnmpError::of( SnmpError::Kind::WrongType );
+	}
+
+}
+
 int SnmpBackend::securityLevelToInt ( const std::string & securityLevel )
 {
 	if (securityLevel == "noAuthNoPriv") return SNMP_SEC_LEVEL_NOAUTH;
@@ -32,6 +32,11 @@
 #include <SnmpBackend.h>
 #include <MuleLogComponents.h>
 
+#include <charconv>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+
 namespace Snmp
 {
 
@@ -39,281 +44,266 @@ using Mule::LogComponentLevels;
 
 std::pair<SnmpStatus, int32_t> SnmpBackend::snmpGetInt( const std::string& oidOfInterest )
 {
+	return snmpGetInt( prepareOid( oidOfInterest ) );
+}
 
-	netsnmp_variable_list *vars;
-	int32_t value(0);
-	PduPtr response = snmpGet ( oidOfInterest );
-
-	if (response)
-	{
-
-		/* manipulate the information ourselves */
-		for(vars = response->variables; vars; vars = vars->next_variable)
-		{
-			if (vars->type == ASN_INTEGER)
-			{
-				value = *vars->val.integer;
-				return std::pair<SnmpStatus, int32_t>(Snmp_Good, value);
-			}
-			else
-			{
-				LOG(Log::TRC, LogComponentLevels::mule()) << "There is no such variable name in this MIB. Type: 0x" << std::hex << (int)(vars->type)
-								<< ". Failed OID: " << oidOfInterest;
-				return std::pair<SnmpStatus, int32_t>(Snmp_BadNoDataAvailable, value);
-			}
-		}
-
-	}
-
-	return std::pair<SnmpStatus, int32_t>(Snmp_Bad, value);
-
+std::pair<SnmpStatus, int32_t> SnmpBackend::snmpGetInt( const Oid& oidOfInterest )
+{
+	return snmpGet<int32_t>( oidOfInterest );
 }
 
 std::pair<SnmpStatus, uint32_t> SnmpBackend::snmpGetUInt( const std::string& oidOfInterest )
 {
-	netsnmp_variable_list *vars;
-	uint32_t value(0);
-	PduPtr response = snmpGet ( oidOfInterest );
-
-	if (response)
-	{
-
-		/* manipulate the information ourselves */
-		for(vars = response->variables; vars; vars = vars->next_variable)
-		{
-			if (vars->type == ASN_UNSIGNED)
-			{
-				value = static_cast<uint32_t>(*vars->val.integer); // net-snmp transmits unsigned value via signed union element :(
-				return std::pair<SnmpStatus, uint32_t>(Snmp_Good, value);
-			}
-			else
-			{
-				LOG(Log::TRC, LogComponentLevels::mule()) << "There is no such variable name in this MIB. Type: 0x" << std::hex << (int)(vars->type)
-								<< ". Failed OID: " << oidOfInterest;
-				return std::pair<SnmpStatus, uint32_t>(Snmp_BadNoDataAvailable, value);
-			}
-		}
-
-	}
-
-	return std::pair<SnmpStatus, uint32_t>(Snmp_Bad, value);		
+	return snmpGetUInt( prepareOid( oidOfInterest ) );
 }
 
-std::pair<SnmpStatus, std::string> SnmpBackend::snmpGetString( const std::string& oidOfInterest )
+std::pair<SnmpStatus, uint32_t> SnmpBackend::snmpGetUInt( const Oid& oidOfInterest )
 {
+	if ( isCircuitOpen() )
+		return std::pair<SnmpStatus, uint32_t>(Snmp_BadNoCommunication, 0);
 
-	netsnmp_variable_list *vars;
-	std::string value("");
-	PduPtr response = snmpGet ( oidOfInterest );
-
-	if (response)
+	PduPtr response = snmpGet( oidOfInterest );
+	if ( response && response->variables && response->variables->type != ASN_UNSIGNED )
 	{
-
-		/* manipulate the information ourselves */
-		for(vars = response->variables; vars; vars = vars->next_variable)
-		{
-			if (vars->type == ASN_OCTET_STR)
-			{
-				value = (reinterpret_cast<const char*>(vars->val.string));
-				return std::pair<SnmpStatus, std::string>(Snmp_Good, value);
-			}
-			else
-			{
-				LOG(Log::TRC, LogComponentLevels::mule()) << "There is no such variable name in this MIB. Type: 0x" << std::hex << (int)(vars->type)
-								<< ". Failed OID: " << oidOfInterest;
-				return std::pair<SnmpStatus, std::string>(Snmp_BadNoDataAvailable, value);
-			}
-		}
-
+		logUnexpectedType( response->variables, oidOfInterest );
+		return std::pair<SnmpStatus, uint32_t>(Snmp_BadNoDataAvailable, 0);
 	}
+	return decodeResponse<uint32_t>( response.get(), oidOfInterest );
+}
 
-	return std::pair<SnmpStatus, std::string>(Snmp_BadNotImplemented, value);
+std::pair<SnmpStatus, std::string> SnmpBackend::snmpGetString( const std::string& oidOfInterest )
+{
+	return snmpGetString( prepareOid( oidOfInterest ) );
+}
 
+std::pair<SnmpStatus, std::string> SnmpBackend::snmpGetString( const Oid& oidOfInterest )
+{
+	return snmpGet<std::string>( oidOfInterest );
 }
 
 std::pair<SnmpStatus, unsigned char > SnmpBackend::snmpGetBoolean( const std::string& oidOfInterest )
 {
+	return snmpGetBoolean( prepareOid( oidOfInterest ) );
+}
 
-	LOG(Log::TRC, LogComponentLevels::mule()) << "UpdateOidToBoolean:" << oidOfInterest << " on device: " << getHostName();
-
-	netsnmp_variable_list *vars;
-	int32_t value(0);
-	PduPtr response = snmpGet ( oidOfInterest );
+std::pair<SnmpStatus, unsigned char > SnmpBackend::snmpGetBoolean( const Oid& oidOfInterest )
+{
 
-	if (response)
-	{
+	LOG(Log::TRC, LogComponentLevels::mule()) << "UpdateOidToBoolean:" << oidOfInterest << " on device: " << getHostName();
 
-		/* manipulate the information ourselves */
-		for(vars = response->variables; vars; vars = vars->next_variable)
-		{
-			if (vars->type == ASN_INTEGER)
-			{
-				value = *vars->val.integer;
-				std::pair<SnmpStatus, unsigned char > castedValue = translateIntToBoolean ( value );
-				return std::pair<SnmpStatus, unsigned char >( castedValue );
-			}
-			else
-			{
-				LOG(Log::TRC, LogComponentLevels::mule()) << "There is no such variable name in this MIB. Type: 0x" << std::hex << (int)(vars->type)
-								<< ". Failed OID: " << oidOfInterest;
-				return std::pair<SnmpStatus, unsigned char >(Snmp_BadNoDataAvailable, value);
-			}
-		}
+	const auto rawValue = snmpGet<int32_t>( oidOfInterest );
 
-	}
+	if ( rawValue.first != Snmp_Good )
+		return std::pair<SnmpStatus, unsigned char >(rawValue.first, rawValue.second);
 
-	return std::pair<SnmpStatus, unsigned char >(Snmp_BadNotImplemented, value);
+	return translateIntToBoolean ( rawValue.second );
 
 }
 
 std::pair<SnmpStatus, std::string> SnmpBackend::snmpGetTime( const std::string& oidOfInterest )
+{
+	return snmpGetTime( prepareOid( oidOfInterest ) );
+}
+
+std::pair<SnmpStatus, std::string> SnmpBackend::snmpGetTime( const Oid& oidOfInterest )
 {
 
-	netsnmp_variable_list *vars;
-	time_t value{};
-	PduPtr response = snmpGet ( oidOfInterest );
+	const auto rawValue = snmpGet<int32_t>( oidOfInterest );
 
-	if (response)
-	{
+	if ( rawValue.first != Snmp_Good )
+		return std::pair<SnmpStatus, std::string>(rawValue.first, "");
 
-		/* manipulate the information ourselves */
-		for(vars = response->variables; vars; vars = vars->next_variable)
-		{
-			if (vars->type == ASN_INTEGER)
-				{
-					value = *vars->val.integer;
-					SnmpStatus status = Snmp_Good;
-					
-					char buf[64];
-					strftime(buf, sizeof buf, "%a %b %e %H:%M:%S %Y\n", localtime(&value));
-					std::string timeString(buf);
-
-					if (value == -1 )
-						status = Snmp_BadDataUnavailable;
-					else
-					{
-						status = Snmp_Good;
-					}
-					return std::pair<SnmpStatus, std::string>( status, timeString );
-				}
-				else
-				{
-					LOG(Log::TRC, LogComponentLevels::mule()) << "There is no such variable name in this MIB. Type: 0x" << std::hex << (int)(vars->type)
-									<< ". Failed OID: " << oidOfInterest;
-					return std::pair<SnmpStatus, std::string>(Snmp_BadNoDataAvailable, "");
-				}
-		}
+	time_t value = rawValue.second;
 
-	}
+	char buf[64];
+	strftime(buf, sizeof buf, "%a %b %e %H:%M:%S %Y\n", localtime(&value));
+	std::string timeString(buf);
 
-	return std::pair<SnmpStatus, std::string>(Snmp_BadNotImplemented, "");
+	return std::pair<SnmpStatus, std::string>( value == -1 ? Snmp_BadDataUnavailable : Snmp_Good, timeString );
 
 }
 
 std::pair<SnmpStatus, std::vector<uint8_t>> SnmpBackend::snmpGetHex( const std::string& oidOfInterest )
 {
+	return snmpGetHex( prepareOid( oidOfInterest ) );
+}
 
-	netsnmp_variable_list *vars;
-	std::vector<uint8_t> value{};
-	PduPtr response = snmpGet ( oidOfInterest );
+std::pair<SnmpStatus, std::vector<uint8_t>> SnmpBackend::snmpGetHex( const Oid& oidOfInterest )
+{
+	return snmpGet<std::vector<uint8_t>>( oidOfInterest );
+}
 
-	if (response)
-	{
+std::pair<SnmpStatus, uint64_t> SnmpBackend::snmpGetCounter64( const std::string& oidOfInterest )
+{
+	return snmpGetCounter64( prepareOid( oidOfInterest ) );
+}
 
-		/* manipulate the information ourselves */
-		for(vars = response->variables; vars; vars = vars->next_variable)
-		{
-			if (vars->type == ASN_OCTET_STR)
-			{
+std::pair<SnmpStatus, uint64_t> SnmpBackend::snmpGetCounter64( const Oid& oidOfInterest )
+{
+	return snmpGet<uint64_t>( oidOfInterest );
+}
 
-				uint8_t* myHexValue = (reinterpret_cast<uint8_t*>(vars->val.string));
-				std::vector<uint8_t> hexValue(&myHexValue[0], &myHexValue[vars->val_len]);
-				return std::pair<SnmpStatus, std::vector<uint8_t>>(Snmp_Good, hexValue);
+std::pair<SnmpStatus, TimeTicks> SnmpBackend::snmpGetTimeTicks( const std::string& oidOfInterest )
+{
+	return snmpGetTimeTicks( prepareOid( oidOfInterest ) );
+}
 
-			}
-			else
-			{
+std::pair<SnmpStatus, TimeTicks> SnmpBackend::snmpGetTimeTicks( const Oid& oidOfInterest )
+{
+	return snmpGet<TimeTicks>( oidOfInterest );
+}
 
-				LOG(Log::TRC, LogComponentLevels::mule()) << "There is no such variable name in this MIB. Type: 0x" << std::hex << (int)(vars->type)
-								<< ". Failed OID: " << oidOfInterest;
-				return std::pair<SnmpStatus, std::vector<uint8_t>>(Snmp_BadNoDataAvailable, value);
+std::pair<SnmpStatus, IpAddress> SnmpBackend::snmpGetIpAddress( const std::string& oidOfInterest )
+{
+	return snmpGetIpAddress( prepareOid( oidOfInterest ) );
+}
 
-			}
-		}
+std::pair<SnmpStatus, IpAddress> SnmpBackend::snmpGetIpAddress( const Oid& oidOfInterest )
+{
+	return snmpGet<IpAddress>( oidOfInterest );
+}
 
-	}
+std::pair<SnmpStatus, float> SnmpBackend::snmpGetFloat( const std::string& oidOfInterest )
+{
+	return snmpGetFloat( prepareOid( oidOfInterest ) );
+}
 
-	return std::pair<SnmpStatus, std::vector<uint8_t>>(Snmp_BadNotImplemented, value);
+std::pair<SnmpStatus, float> SnmpBackend::snmpGetFloat( const Oid& oidOfInterest )
+{
+#ifdef NETSNMP_WITH_OPAQUE_SPECIAL_TYPES
+	return snmpGet<float>( oidOfInterest );
+#else
+	return std::pair<SnmpStatus, float>(Snmp_BadNotSupported, 0.0f);
+#endif
+}
+
+std::pair<SnmpStatus, double> SnmpBackend::snmpGetDouble( const std::string& oidOfInterest )
+{
+	return snmpGetDouble( prepareOid( oidOfInterest ) );
+}
 
+std::pair<SnmpStatus, double> SnmpBackend::snmpGetDouble( const Oid& oidOfInterest )
+{
+#ifdef NETSNMP_WITH_OPAQUE_SPECIAL_TYPES
+	return snmpGet<double>( oidOfInterest );
+#else
+	return std::pair<SnmpStatus, double>(Snmp_BadNotSupported, 0.0);
+#endif
 }
 
 std::pair<SnmpStatus, float> SnmpBackend::snmpGetFloatFromString( const std::string& oidOfInterest )
 {
+	return snmpGetFloatFromString( prepareOid( oidOfInterest ) );
+}
 
-	netsnmp_variable_list *vars;
-	float value{0.0};
-	PduPtr response = snmpGet ( oidOfInterest );
+std::pair<SnmpStatus, float> SnmpBackend::snmpGetFloatFromString( const Oid& oidOfInterest )
+{
 
-	if (response)
-	{
+	std::pair<SnmpStatus, float> result(Snmp_Good, 0.0f);
 
-		/* manipulate the information ourselves */
-		for(vars = response->variables; vars; vars = vars->next_variable)
-		{
-			if (vars->type == ASN_OCTET_STR)
-			{
-
-				std::string castToString = (reinterpret_cast<const char*>(vars->val.string));
-				if ( castToString == "N/A" )
-				{
-					return std::pair<SnmpStatus, float>(Snmp_BadNoDataAvailable, value);
-				}
-				else
-				{
-					try
-					{
-						value = std::stof( castToString );
-					}
-					catch (const std::exception& e)
-					{
-						LOG(Log::ERR, LogComponentLevels::mule()) << e.what() << ": Cannot convert sensor value. Due to sensor type? (OID:" << oidOfInterest << ")";
-					}
-				}
-				return std::pair<SnmpStatus, float>(Snmp_Good, value);
-
-			}
-			else
-			{
-
-				LOG(Log::TRC, LogComponentLevels::mule()) << "There is no such variable name in this MIB. Type: 0x" << std::hex << (int)(vars->type)
-								<< ". Failed OID: " << oidOfInterest;
-				return std::pair<SnmpStatus, float>(Snmp_BadNoDataAvailable, value);
-
-			}
-		}
+	// Parsed in place, the string never leaves the response PDU
+	const SnmpStatus status = snmpGetView( oidOfInterest, [&result] ( std::string_view view ) {
+		result = ( view == "N/A" ) ? std::pair<SnmpStatus, float>(Snmp_BadNoDataAvailable, 0.0f) : floatFromString( view );
+	});
 
-	}
+	if ( status != Snmp_Good )
+		return std::pair<SnmpStatus, float>(status, 0.0f);
 
-	return std::pair<SnmpStatus, float>(Snmp_BadNotImplemented, value);
+	if ( result.first == Snmp_BadDataUnavailable )
+		LOG(Log::ERR, LogComponentLevels::mule()) << "Cannot convert sensor value. Due to sensor type? (OID:" << oidOfInterest << ")";
+
+	return result;
+
+}
+
+std::pair<SnmpStatus, float> SnmpBackend::floatFromString( std::string_view text )
+{
+
+	// std::stof skips leading blanks and takes a sign, from_chars does neither
+	size_t start = 0;
+	while ( start < text.size() && std::isspace( static_cast<unsigned char>(text[start]) ) )
+		start++;
+	if ( start < text.size() && text[start] == '+' )
+		start++;
+
+	float value{0.0};
+	const char * first = text.data() + start;
+	const char * last = text.data() + text.size();
+
+#if defined(__cpp_lib_to_chars)
+	const auto parsed = std::from_chars( first, last, value );
+	if ( parsed.ec != std::errc() )
+		return std::pair<SnmpStatus, float>(Snmp_BadDataUnavailable, 0.0f);
+#else
+	// strtof needs a terminated string, sensor readings fit on the stack
+	char buffer[64];
+	const size_t length = std::min<size_t>( last - first, sizeof buffer - 1 );
+	std::memcpy( buffer, first, length );
+	buffer[length] = '\0';
+	char * end = nullptr;
+	value = std::strtof( buffer, &end );
+	if ( end == buffer )
+		return std::pair<SnmpStatus, float>(Snmp_BadDataUnavailable, 0.0f);
+#endif
+
+	return std::pair<SnmpStatus, float>(Snmp_Good, value);
 
 }
 
 std::pair<SnmpStatus, float> SnmpBackend::snmpGetFloatFromInt( const std::string& oidOfInterest, const float& scaleFactor )
+{
+	return snmpGetFloatFromInt( prepareOid( oidOfInterest ), scaleFactor );
+}
+
+std::pair<SnmpStatus, float> SnmpBackend::snmpGetFloatFromInt( const Oid& oidOfInterest, const float& scaleFactor )
 {
 	const auto intResult = snmpGetInt(oidOfInterest);
 	return { std::get<0>(intResult), scaleFactor * std::get<1>(intResult) };
 }
 
-std::string SnmpBackend::oidToString(const oid * objid, size_t objidlen, const netsnmp_variable_list * vars)
+std::pair<SnmpStatus, snmpGetValue> SnmpBackend::decodeVariable ( const netsnmp_variable_list * vars )
 {
-
-	std::string oid;
-	oid = {std::to_string(*(objid))};
-	for (uint32_t i = 1; i < objidlen; i++)
+	switch (vars->type)
 	{
-	 	oid += "." + std::to_string(*(objid + i));
+		case ASN_INTEGER:
+			return std::pair<SnmpStatus, snmpGetValue>(Snmp_Good, static_cast<int32_t>(*vars->val.integer));
+		case ASN_UNSIGNED: // same tag as ASN_GAUGE
+		case ASN_COUNTER:
+		case ASN_TIMETICKS:
+			return std::pair<SnmpStatus, snmpGetValue>(Snmp_Good, static_cast<uint32_t>(*vars->val.integer));
+		case ASN_OCTET_STR:
+			return std::pair<SnmpStatus, snmpGetValue>(Snmp_Good, std::string(reinterpret_cast<const char*>(vars->val.string), vars->val_len));
+		case ASN_COUNTER64:
+			return std::pair<SnmpStatus, snmpGetValue>(Snmp_Good, SnmpTypeTraits<uint64_t>::decode( vars ));
+		case ASN_IPADDRESS:
+			return std::pair<SnmpStatus, snmpGetValue>(Snmp_Good, SnmpTypeTraits<IpAddress>::decode( vars ));
+#ifdef NETSNMP_WITH_OPAQUE_SPECIAL_TYPES
+		case ASN_OPAQUE_FLOAT:
+			return std::pair<SnmpStatus, snmpGetValue>(Snmp_Good, *vars->val.floatVal);
+		case ASN_OPAQUE_DOUBLE:
+			return std::pair<SnmpStatus, snmpGetValue>(Snmp_Good, *vars->val.doubleVal);
+#endif
+		case SNMP_NOSUCHOBJECT:
+		case SNMP_NOSUCHINSTANCE:
+		case SNMP_ENDOFMIBVIEW:
+			LOG(Log::TRC, LogComponentLevels::mule()) << "There is no such variable name in this MIB. Type: 0x" << std::hex << (int)(vars->type);
+			return std::pair<SnmpStatus, snmpGetValue>(Snmp_BadNoDataAvailable, std::monostate());
+		default:
+			LOG(Log::TRC, LogComponentLevels::mule()) << "Type is not supported. Type: 0x" << std::hex << (int)(vars->type);
+			return std::pair<SnmpStatus, snmpGetValue>(Snmp_BadNotSupported, std::monostate());
 	}
-	return oid;
+}
+
+void SnmpBackend::logUnexpectedType ( const netsnmp_variable_list * vars, const Oid& oidOfInterest )
+{
+	LOG(Log::TRC, LogComponentLevels::mule()) << "There is no such variable name in this MIB. Type: 0x" << std::hex << (int)(vars->type)
+					<< ". Failed OID: " << oidOfInterest;
+}
+
+std::string SnmpBackend::oidToString(const oid * objid, size_t objidlen, const netsnmp_variable_list * vars)
+{
+
+	return Oid( objid, objidlen ).getOidString();
 }
 
 std::pair<SnmpStatus, unsigned char > SnmpBackend::translateIntToBoolean ( int32_t rawValue )
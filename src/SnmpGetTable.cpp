@@ -0,0 +1,215 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <SnmpExceptions.h>
+#include <SnmpBackend.h>
+#include <MuleLogComponents.h>
+
+#include <map>
+#include <set>
+
+namespace Snmp
+{
+
+using Mule::LogComponentLevels;
+
+SnmpTable SnmpBackend::snmpGetTable( const std::string& tableOid, const std::vector<oid>& columns, long maxRepetitions )
+{
+
+	return snmpGetTable( prepareOid( tableOid ), columns, maxRepetitions );
+
+}
+
+SnmpTable SnmpBackend::snmpGetTable( const Oid& tableOid, const std::vector<oid>& columns, long maxRepetitions )
+{
+
+	LOG(Log::DBG, LogComponentLevels::mule()) << "SNMP table fetch of " << tableOid << " (" << columns.size() << " columns) from: " << getHostName();
+
+	struct ColumnCursor
+	{
+		Oid columnOid;
+		// last OID received, where the next request continues from
+		Oid position;
+		bool done;
+		std::map<Oid, std::pair<SnmpStatus, snmpGetValue>> cells;
+	};
+
+	std::vector<ColumnCursor> cursors;
+	cursors.reserve( columns.size() );
+	for ( const oid column : columns )
+	{
+		Oid columnOid = tableOid;
+		columnOid.append( 1 ).append( column );
+		cursors.push_back( ColumnCursor{ columnOid, columnOid, false, {} } );
+	}
+
+	// GETBULK does not exist in SNMPv1
+	const bool bulk = m_snmpVersion != "1" && maxRepetitions > 0;
+	long repetitions = maxRepetitions;
+	// Lowered when even a single row of the active columns is too big for the agent
+	size_t columnsPerPdu = cursors.size();
+
+	std::vector<size_t> active;
+	Snmp::Oid walkedOid;
+
+	while ( true )
+	{
+
+		active.clear();
+		for ( size_t column = 0; column < cursors.size() && active.size() < columnsPerPdu; column++ )
+			if ( !cursors[column].done )
+				active.push_back( column );
+
+		if ( active.empty() )
+			break;
+
+		// Keep the response within the varbinds an agent was seen to answer at once
+		const long fitting = static_cast<long>( m_maxVarbindsPerPdu / active.size() );
+		const long sentRepetitions = std::max( 1L, std::min( repetitions, fitting ) );
+
+		netsnmp_pdu *pdu = snmp_pdu_create( bulk ? SNMP_MSG_GETBULK : SNMP_MSG_GETNEXT );
+		if ( bulk )
+		{
+			pdu->non_repeaters = 0;
+			pdu->max_repetitions = sentRepetitions;
+		}
+		for ( const size_t column : active )
+			snmp_add_null_var( pdu, cursors[column].position.data(), cursors[column].position.size() );
+
+		netsnmp_pdu *rawResponse = nullptr;
+		const int snmp_status = synchResponse( pdu, &rawResponse );
+		PduPtr response( rawResponse );
+
+		if ( snmp_status == STAT_SUCCESS && response->errstat == SNMP_ERR_TOOBIG && bulk && sentRepetitions > 1 )
+		{
+			repetitions = sentRepetitions / 2;
+			LOG(Log::DBG, LogComponentLevels::mule()) << "[" << m_hostname << "] " << "Table response too big, asking " << repetitions << " rows per PDU";
+			continue;
+		}
+
+		if ( snmp_status == STAT_SUCCESS && response->errstat == SNMP_ERR_TOOBIG && active.size() > 1 )
+		{
+			columnsPerPdu = active.size() / 2;
+			LOG(Log::DBG, LogComponentLevels::mule()) << "[" << m_hostname << "] " << "Table row too big, asking " << columnsPerPdu << " columns per PDU";
+			continue;
+		}
+
+		// SNMPv1 agents answer noSuchName for the varbind which ran past their MIB view
+		if ( snmp_status == STAT_SUCCESS && response->errstat == SNMP_ERR_NOSUCHNAME && m_snmpVersion == "1"
+				&& response->errindex >= 1 && static_cast<size_t>( response->errindex ) <= active.size() )
+		{
+			cursors[ active[response->errindex - 1] ].done = true;
+			continue;
+		}
+
+		try
+		{
+			throwIfSnmpResponseError( snmp_status, response.get() );
+		}
+		catch (const std::exception& e)
+		{
+			LOG(Log::ERR, LogComponentLevels::mule()) << "At table fetch of " << tableOid << " from: " << getHostName() << " ." << e.what();
+			throw;
+		}
+
+		/*
+		 *	Varbinds come row by row, one per requested column, possibly truncated by the agent
+		 */
+		size_t position = 0;
+		for ( netsnmp_variable_list *vars = response->variables; vars; vars = vars->next_variable, position++ )
+		{
+			ColumnCursor& cursor = cursors[ active[position % active.size()] ];
+			if ( cursor.done )
+				continue;
+
+			if ( vars->type == SNMP_ENDOFMIBVIEW )
+			{
+				cursor.done = true;
+				continue;
+			}
+
+			walkedOid.assign( vars->name, vars->name_length );
+
+			// Left the column, or an agent not answering in lexicographic order
+			if ( !cursor.columnOid.isPrefixOf( walkedOid ) || walkedOid.compare( cursor.position ) <= 0 )
+			{
+				cursor.done = true;
+				continue;
+			}
+
+			Oid rowIndex( walkedOid.data() + cursor.columnOid.size(), walkedOid.size() - cursor.columnOid.size() );
+			cursor.cells.emplace( std::move(rowIndex), decodeVariable( vars ) );
+			cursor.position = walkedOid;
+		}
+
+		// Nothing to continue from
+		if ( position == 0 )
+			for ( const size_t column : active )
+				cursors[column].done = true;
+
+	}
+
+	/*
+	 *	Rows of all the columns, sorted. Cells of a column are sorted as well, so each column is
+	 *	merged in one pass.
+	 */
+	SnmpTable table;
+	table.columns = columns;
+
+	std::set<Oid> rows;
+	for ( const auto& cursor : cursors )
+		for ( const auto& cell : cursor.cells )
+			rows.insert( cell.first );
+
+	table.rowIndices.reserve( rows.size() );
+	for ( const auto& row : rows )
+		table.rowIndices.push_back( row );
+
+	table.values.assign( cursors.size(), std::vector<std::pair<SnmpStatus, snmpGetValue>>( table.rowIndices.size(),
+		std::pair<SnmpStatus, snmpGetValue>(Snmp_BadNoDataAvailable, std::monostate()) ) );
+
+	for ( size_t column = 0; column < cursors.size(); column++ )
+	{
+		size_t row = 0;
+		for ( auto& cell : cursors[column].cells )
+		{
+			while ( table.rowIndices[row] != cell.first )
+				row++;
+			table.values[column][row] = std::move( cell.second );
+		}
+	}
+
+	LOG(Log::DBG, LogComponentLevels::mule()) << "SNMP table fetch of " << tableOid << " got " << table.rowCount() << " rows";
+
+	return table;
+
+}
+
+}
@@ -0,0 +1,95 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <SnmpLibrary.h>
+#include <MuleLogComponents.h>
+
+#include <cstdlib>
+
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+
+using Mule::LogComponentLevels;
+
+namespace Snmp
+{
+
+std::once_flag SnmpLibrary::s_once;
+std::atomic<bool> SnmpLibrary::s_initialized(false);
+
+bool SnmpLibrary::initialize( const SnmpLibraryOptions& options )
+{
+
+	bool initializedHere = false;
+	std::call_once( s_once, [&options, &initializedHere] {
+		doInitialize( options );
+		initializedHere = true;
+	});
+	return initializedHere;
+
+}
+
+void SnmpLibrary::doInitialize( const SnmpLibraryOptions& options )
+{
+
+	switch ( options.mibLoading )
+	{
+		case SnmpLibraryOptions::MibLoading::None:
+			// Same as "-m ''" of the net-snmp command line tools
+			setenv( "MIBS", "", 1 );
+			break;
+		case SnmpLibraryOptions::MibLoading::List:
+			setenv( "MIBS", options.mibs.c_str(), 1 );
+			break;
+		case SnmpLibraryOptions::MibLoading::FromEnvironment:
+			break;
+	}
+
+	if ( !options.mibDirectories.empty() )
+		netsnmp_set_mib_directory( options.mibDirectories.c_str() );
+
+	if ( !options.readConfigurationFiles )
+	{
+		netsnmp_ds_set_boolean( NETSNMP_DS_LIBRARY_ID, NETSNMP_DS_LIB_DONT_READ_CONFIGS, 1 );
+		netsnmp_ds_set_boolean( NETSNMP_DS_LIBRARY_ID, NETSNMP_DS_LIB_DONT_PERSIST_STATE, 1 );
+	}
+
+	const auto envMIBS = getenv("MIBS");
+	const auto envMIBDIRS = getenv("MIBDIRS");
+	LOG(Log::INF, LogComponentLevels::mule()) << __FUNCTION__ << " calling init_snmp with $env:MIBS ["<<( envMIBS? envMIBS : "NULL" )<<"] $env.MIBDIRS ["<<( envMIBDIRS? envMIBDIRS : "NULL" )<<"]";
+
+	SOCK_STARTUP;
+	init_snmp("mule");
+
+	s_initialized = true;
+
+}
+
+}
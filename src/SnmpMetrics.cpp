@@ -0,0 +1,321 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <SnmpMetrics.h>
+
+#include <cmath>
+#include <algorithm>
+
+namespace Snmp
+{
+
+namespace
+{
+
+size_t latencyBucket( uint64_t us )
+{
+	size_t bucket = 0;
+	while ( us != 0 && bucket < SnmpMetrics::LATENCY_BUCKETS - 1 )
+	{
+		us >>= 1;
+		bucket++;
+	}
+	return bucket;
+}
+
+/*
+ *	Length of a BER tag-length-value whose value is length bytes long
+ */
+size_t berSize( size_t length )
+{
+	size_t lengthBytes = 1;
+	if ( length > 127 )
+		for ( size_t remaining = length; remaining; remaining >>= 8 )
+			lengthBytes++;
+	return 1 + lengthBytes + length;
+}
+
+size_t berSubIdentifierSize( oid subIdentifier )
+{
+	size_t bytes = 1;
+	while ( subIdentifier >>= 7 )
+		bytes++;
+	return bytes;
+}
+
+size_t berIntegerSize( long value )
+{
+	size_t bytes = 1;
+	while ( bytes < sizeof(long) && ( value >= 128 || value < -128 ) )
+	{
+		value >>= 8;
+		bytes++;
+	}
+	return bytes;
+}
+
+size_t berObjectIdSize( const oid * objid, size_t length )
+{
+	// The first two sub-identifiers share one byte
+	size_t bytes = length >= 2 ? 1 : length;
+	for ( size_t i = 2; i < length; i++ )
+		bytes += berSubIdentifierSize( objid[i] );
+	return bytes;
+}
+
+}
+
+uint64_t SnmpMetrics::Snapshot::totalRequests() const
+{
+
+	uint64_t total = 0;
+	for ( const uint64_t count : requests )
+		total += count;
+	return total;
+
+}
+
+double SnmpMetrics::Snapshot::varbindsPerRequest() const
+{
+
+	const uint64_t total = totalRequests();
+	return total ? static_cast<double>( varbindsSent ) / total : 0.0;
+
+}
+
+uint64_t SnmpMetrics::Snapshot::latencyPercentileUs( double quantile ) const
+{
+
+	uint64_t count = 0;
+	for ( const uint64_t bucketCount : latency )
+		count += bucketCount;
+	if ( count == 0 )
+		return 0;
+
+	const uint64_t rank = static_cast<uint64_t>( std::ceil( quantile * count ) );
+	uint64_t seen = 0;
+	for ( size_t bucket = 0; bucket < LATENCY_BUCKETS; bucket++ )
+	{
+		seen += latency[bucket];
+		if ( seen >= rank && seen > 0 )
+			return bucket == 0 ? 0 : ( uint64_t(1) << bucket ) - 1;
+	}
+	return ( uint64_t(1) << (LATENCY_BUCKETS - 1) ) - 1;
+
+}
+
+SnmpMetrics::Snapshot& SnmpMetrics::Snapshot::operator+=( const Snapshot& other )
+{
+
+	for ( size_t i = 0; i < PDU_TYPES; i++ )
+		requests[i] += other.requests[i];
+	varbindsSent += other.varbindsSent;
+	varbindsReceived += other.varbindsReceived;
+	varbindBytesSent += other.varbindBytesSent;
+	varbindBytesReceived += other.varbindBytesReceived;
+	timeouts += other.timeouts;
+	sendErrors += other.sendErrors;
+	rejected += other.rejected;
+	for ( size_t i = 0; i < ERROR_STATUSES; i++ )
+		errorStatuses[i] += other.errorStatuses[i];
+	for ( size_t i = 0; i < LATENCY_BUCKETS; i++ )
+		latency[i] += other.latency[i];
+	sessionWaitUs += other.sessionWaitUs;
+	maxSessionWaitUs = std::max( maxSessionWaitUs, other.maxSessionWaitUs );
+	return *this;
+
+}
+
+SnmpMetrics::Snapshot SnmpMetrics::Snapshot::aggregate( const std::vector<Snapshot>& snapshots )
+{
+
+	Snapshot total;
+	for ( const auto& snapshot : snapshots )
+		total += snapshot;
+	return total;
+
+}
+
+SnmpMetrics::SnmpMetrics()
+{
+
+	reset();
+
+}
+
+void SnmpMetrics::recordSessionWait( std::chrono::microseconds wait )
+{
+
+	const uint64_t waitUs = wait.count();
+	m_sessionWaitUs.fetch_add( waitUs, std::memory_order_relaxed );
+
+	uint64_t maximum = m_maxSessionWaitUs.load( std::memory_order_relaxed );
+	while ( waitUs > maximum && !m_maxSessionWaitUs.compare_exchange_weak( maximum, waitUs, std::memory_order_relaxed ) ) {}
+
+}
+
+void SnmpMetrics::recordRequest( const netsnmp_pdu * request )
+{
+
+	size_t type;
+	switch ( request->command )
+	{
+		case SNMP_MSG_GET: type = Snmp::Constants::GET; break;
+		case SNMP_MSG_SET: type = Snmp::Constants::SET; break;
+		case SNMP_MSG_GETNEXT: type = Snmp::Constants::GET_NEXT; break;
+		case SNMP_MSG_GETBULK: type = Snmp::Constants::GET_BULK; break;
+		case SNMP_MSG_INFORM: type = Snmp::Constants::INFORM; break;
+		default: type = Snmp::Constants::TRAP; break;
+	}
+	m_requests[type].fetch_add( 1, std::memory_order_relaxed );
+
+	uint64_t varbinds = 0;
+	for ( const netsnmp_variable_list * vars = request->variables; vars; vars = vars->next_variable )
+		varbinds++;
+	m_varbindsSent.fetch_add( varbinds, std::memory_order_relaxed );
+	m_varbindBytesSent.fetch_add( varbindBytes( request ), std::memory_order_relaxed );
+
+}
+
+void SnmpMetrics::recordResponse( int status, const netsnmp_pdu * response, std::chrono::microseconds latency )
+{
+
+	if ( status == STAT_TIMEOUT )
+	{
+		m_timeouts.fetch_add( 1, std::memory_order_relaxed );
+		return;
+	}
+
+	if ( status != STAT_SUCCESS || !response )
+	{
+		m_sendErrors.fetch_add( 1, std::memory_order_relaxed );
+		return;
+	}
+
+	m_latency[ latencyBucket( latency.count() ) ].fetch_add( 1, std::memory_order_relaxed );
+
+	if ( response->errstat >= 0 && static_cast<size_t>( response->errstat ) < ERROR_STATUSES )
+		m_errorStatuses[ response->errstat ].fetch_add( 1, std::memory_order_relaxed );
+
+	uint64_t varbinds = 0;
+	for ( const netsnmp_variable_list * vars = response->variables; vars; vars = vars->next_variable )
+		varbinds++;
+	m_varbindsReceived.fetch_add( varbinds, std::memory_order_relaxed );
+	m_varbindBytesReceived.fetch_add( varbindBytes( response ), std::memory_order_relaxed );
+
+}
+
+void SnmpMetrics::recordRejected()
+{
+
+	m_rejected.fetch_add( 1, std::memory_order_relaxed );
+
+}
+
+SnmpMetrics::Snapshot SnmpMetrics::snapshot() const
+{
+
+	Snapshot snapshot;
+	for ( size_t i = 0; i < PDU_TYPES; i++ )
+		snapshot.requests[i] = m_requests[i].load( std::memory_order_relaxed );
+	snapshot.varbindsSent = m_varbindsSent.load( std::memory_order_relaxed );
+	snapshot.varbindsReceived = m_varbindsReceived.load( std::memory_order_relaxed );
+	snapshot.varbindBytesSent = m_varbindBytesSent.load( std::memory_order_relaxed );
+	snapshot.varbindBytesReceived = m_varbindBytesReceived.load( std::memory_order_relaxed );
+	snapshot.timeouts = m_timeouts.load( std::memory_order_relaxed );
+	snapshot.sendErrors = m_sendErrors.load( std::memory_order_relaxed );
+	snapshot.rejected = m_rejected.load( std::memory_order_relaxed );
+	for ( size_t i = 0; i < ERROR_STATUSES; i++ )
+		snapshot.errorStatuses[i] = m_errorStatuses[i].load( std::memory_order_relaxed );
+	for ( size_t i = 0; i < LATENCY_BUCKETS; i++ )
+		snapshot.latency[i] = m_latency[i].load( std::memory_order_relaxed );
+	snapshot.sessionWaitUs = m_sessionWaitUs.load( std::memory_order_relaxed );
+	snapshot.maxSessionWaitUs = m_maxSessionWaitUs.load( std::memory_order_relaxed );
+	return snapshot;
+
+}
+
+void SnmpMetrics::reset()
+{
+
+	for ( auto& counter : m_requests )
+		counter.store( 0, std::memory_order_relaxed );
+	m_varbindsSent.store( 0, std::memory_order_relaxed );
+	m_varbindsReceived.store( 0, std::memory_order_relaxed );
+	m_varbindBytesSent.store( 0, std::memory_order_relaxed );
+	m_varbindBytesReceived.store( 0, std::memory_order_relaxed );
+	m_timeouts.store( 0, std::memory_order_relaxed );
+	m_sendErrors.store( 0, std::memory_order_relaxed );
+	m_rejected.store( 0, std::memory_order_relaxed );
+	for ( auto& counter : m_errorStatuses )
+		counter.store( 0, std::memory_order_relaxed );
+	for ( auto& counter : m_latency )
+		counter.store( 0, std::memory_order_relaxed );
+	m_sessionWaitUs.store( 0, std::memory_order_relaxed );
+	m_maxSessionWaitUs.store( 0, std::memory_order_relaxed );
+
+}
+
+size_t SnmpMetrics::varbindBytes( const netsnmp_pdu * pdu )
+{
+
+	size_t bytes = 0;
+	for ( const netsnmp_variable_list * vars = pdu->variables; vars; vars = vars->next_variable )
+	{
+		size_t valueBytes;
+		switch ( vars->type )
+		{
+			case ASN_INTEGER:
+			case ASN_COUNTER:
+			case ASN_GAUGE:
+			case ASN_TIMETICKS:
+				valueBytes = berIntegerSize( *vars->val.integer );
+				break;
+			case ASN_OBJECT_ID:
+				valueBytes = berObjectIdSize( vars->val.objid, vars->val_len / sizeof(oid) );
+				break;
+			case ASN_NULL:
+			case SNMP_NOSUCHOBJECT:
+			case SNMP_NOSUCHINSTANCE:
+			case SNMP_ENDOFMIBVIEW:
+				valueBytes = 0;
+				break;
+			default:
+				valueBytes = vars->val_len;
+				break;
+		}
+		const size_t nameBytes = berSize( berObjectIdSize( vars->name, vars->name_length ) );
+		bytes += berSize( nameBytes + berSize( valueBytes ) );
+	}
+	return bytes;
+
+}
+
+} // Snmp
@@ -0,0 +1,197 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <SnmpPollExecutor.h>
+#include <MuleLogComponents.h>
+
+#include <vector>
+
+using Mule::LogComponentLevels;
+
+namespace Snmp
+{
+
+/*
+ *	Backend whose job the current thread is running, if any
+ */
+static thread_local const SnmpBackend * t_polledBackend = nullptr;
+
+SnmpPollExecutor::SnmpPollExecutor( size_t threads ) :
+				m_cycles(0),
+				m_pool(threads)
+{}
+
+void SnmpPollExecutor::addJob( SnmpBackend& backend, PollJob job )
+{
+
+	std::lock_guard<std::mutex> guard(m_slotsMutex);
+
+	auto& slot = m_slots[&backend];
+	if ( !slot )
+	{
+		slot = std::make_shared<BackendSlot>();
+		slot->backend = &backend;
+	}
+
+	std::lock_guard<std::mutex> jobGuard(slot->jobMutex);
+	slot->job = std::move(job);
+
+}
+
+void SnmpPollExecutor::removeJob( SnmpBackend& backend )
+{
+
+	std::shared_ptr<BackendSlot> slot;
+	{
+		std::lock_guard<std::mutex> guard(m_slotsMutex);
+		auto found = m_slots.find( &backend );
+		if ( found == m_slots.end() )
+			return;
+		slot = found->second;
+		m_slots.erase( found );
+	}
+
+	// From the backend's own job: the job in flight is the caller, waiting would never end
+	if ( t_polledBackend == &backend )
+		return;
+
+	while ( slot->inFlight )
+		std::this_thread::sleep_for( std::chrono::milliseconds(1) );
+
+}
+
+std::future<SnmpPollCycleReport> SnmpPollExecutor::runCycle( CycleCallback callback )
+{
+
+	auto cycle = std::make_shared<CycleState>();
+	cycle->report.cycle = ++m_cycles;
+	cycle->start = std::chrono::steady_clock::now();
+	cycle->callback = std::move(callback);
+	auto future = cycle->promise.get_future();
+
+	// Admitted under the lock, so that removeJob either drops a slot before it is admitted or
+	// waits for its job
+	std::vector<std::shared_ptr<BackendSlot>> admitted;
+	{
+		std::lock_guard<std::mutex> guard(m_slotsMutex);
+		admitted.reserve( m_slots.size() );
+		for ( const auto& slot : m_slots )
+		{
+			if ( slot.second->inFlight.exchange(true) )
+			{
+				LOG(Log::DBG, LogComponentLevels::mule()) << "[" << slot.second->backend->getHostName() << "] " << "Still polling, skipped in cycle " << cycle->report.cycle;
+				cycle->report.skipped++;
+				continue;
+			}
+			admitted.push_back( slot.second );
+		}
+	}
+
+	// Counted in full before the first job may finish
+	cycle->remaining = admitted.size() + 1;
+	for ( const auto& slot : admitted )
+		m_pool.submit( [this, slot, cycle] { runJob( slot, cycle ); } );
+
+	if ( --cycle->remaining == 0 )
+		finishCycle( *cycle );
+
+	return future;
+
+}
+
+void SnmpPollExecutor::runJob( const std::shared_ptr<BackendSlot>& slot, const std::shared_ptr<CycleState>& cycle )
+{
+
+	const auto start = std::chrono::steady_clock::now();
+	bool succeeded = true;
+
+	// The backend may be gone as soon as the job returns, once removeJob stopped waiting
+	const std::string hostname = slot->backend->getHostName();
+
+	PollJob job;
+	{
+		std::lock_guard<std::mutex> guard(slot->jobMutex);
+		job = slot->job;
+	}
+
+	t_polledBackend = slot->backend;
+	try
+	{
+		job( *slot->backend );
+	}
+	catch (const std::exception& e)
+	{
+		LOG(Log::ERR, LogComponentLevels::mule()) << "[" << hostname << "] " << "Poll job failed: " << e.what();
+		succeeded = false;
+	}
+	t_polledBackend = nullptr;
+
+	const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - start );
+	slot->inFlight = false;
+
+	{
+		std::lock_guard<std::mutex> guard(cycle->mutex);
+		succeeded ? cycle->report.completed++ : cycle->report.failed++;
+		if ( elapsed > cycle->report.slowestJob )
+		{
+			cycle->report.slowestJob = elapsed;
+			cycle->report.slowestHostname = hostname;
+		}
+	}
+
+	if ( --cycle->remaining == 0 )
+		finishCycle( *cycle );
+
+}
+
+void SnmpPollExecutor::finishCycle( CycleState& cycle )
+{
+
+	cycle.report.duration = std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now() - cycle.start );
+
+	LOG(Log::DBG, LogComponentLevels::mule()) << "Poll cycle " << cycle.report.cycle << " done in " << cycle.report.duration.count() << " us, "
+		<< cycle.report.completed << " completed, " << cycle.report.failed << " failed, " << cycle.report.skipped << " skipped";
+
+	if ( cycle.callback )
+	{
+		try
+		{
+			cycle.callback( cycle.report );
+		}
+		catch (const std::exception& e)
+		{
+			LOG(Log::ERR, LogComponentLevels::mule()) << "Poll cycle callback threw: " << e.what();
+		}
+	}
+	cycle.promise.set_value( cycle.report );
+
+}
+
+}
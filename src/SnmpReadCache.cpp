@@ -0,0 +1,173 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <SnmpReadCache.h>
+#include <MuleLogComponents.h>
+
+using Mule::LogComponentLevels;
+
+namespace Snmp
+{
+
+SnmpReadCache::SnmpReadCache( SnmpBackend& backend, std::chrono::milliseconds defaultTtl ) :
+				m_backend(backend),
+				m_defaultTtl(defaultTtl),
+				m_hits(0),
+				m_misses(0),
+				m_coalesced(0)
+{}
+
+void SnmpReadCache::setTtl( const Oid& prefix, std::chrono::milliseconds ttl )
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	m_ttls[prefix] = ttl;
+
+}
+
+std::shared_ptr<const netsnmp_pdu> SnmpReadCache::get( const Oid& oidOfInterest )
+{
+
+	std::promise<SharedPdu> promise;
+	{
+		std::unique_lock<std::mutex> lock(m_mutex);
+
+		auto cached = m_entries.find( oidOfInterest );
+		if ( cached != m_entries.end() )
+		{
+			if ( !cached->second.ready )
+			{
+				m_coalesced++;
+				std::shared_future<SharedPdu> inFlight = cached->second.response;
+				lock.unlock();
+				return inFlight.get();
+			}
+			if ( std::chrono::steady_clock::now() < cached->second.expiry )
+			{
+				m_hits++;
+				return cached->second.response.get();
+			}
+		}
+
+		m_misses++;
+		m_entries[oidOfInterest] = Entry{ promise.get_future().share(), std::chrono::steady_clock::time_point(), false };
+	}
+
+	try
+	{
+		SharedPdu response( m_backend.snmpGet( oidOfInterest ).release(), PduDeleter() );
+		promise.set_value( response );
+
+		std::lock_guard<std::mutex> guard(m_mutex);
+		const auto ttl = ttlFor( oidOfInterest );
+		auto entry = m_entries.find( oidOfInterest );
+		if ( entry != m_entries.end() )
+		{
+			if ( ttl.count() > 0 )
+			{
+				entry->second.ready = true;
+				entry->second.expiry = std::chrono::steady_clock::now() + ttl;
+			}
+			else
+				m_entries.erase( entry );
+		}
+		return response;
+	}
+	catch (...)
+	{
+		// Waiting callers get the same exception, the next read tries again
+		promise.set_exception( std::current_exception() );
+		std::lock_guard<std::mutex> guard(m_mutex);
+		m_entries.erase( oidOfInterest );
+		throw;
+	}
+
+}
+
+void SnmpReadCache::invalidate( const Oid& oidOfInterest )
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	auto entry = m_entries.find( oidOfInterest );
+	// In flight requests complete for their waiters anyway
+	if ( entry != m_entries.end() && entry->second.ready )
+		m_entries.erase( entry );
+
+}
+
+void SnmpReadCache::clear()
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	for ( auto entry = m_entries.begin(); entry != m_entries.end(); )
+		entry = entry->second.ready ? m_entries.erase( entry ) : std::next( entry );
+
+}
+
+SnmpReadCache::Statistics SnmpReadCache::getStatistics() const
+{
+
+	Statistics statistics;
+	statistics.hits = m_hits;
+	statistics.misses = m_misses;
+	statistics.coalesced = m_coalesced;
+	return statistics;
+
+}
+
+void SnmpReadCache::resetStatistics()
+{
+
+	m_hits = 0;
+	m_misses = 0;
+	m_coalesced = 0;
+
+}
+
+std::chrono::milliseconds SnmpReadCache::ttlFor( const Oid& oidOfInterest ) const
+{
+
+	if ( m_ttls.empty() )
+		return m_defaultTtl;
+
+	// Longest prefix first
+	Oid prefix( oidOfInterest );
+	for ( size_t length = oidOfInterest.size(); length > 0; length-- )
+	{
+		prefix.assign( oidOfInterest.data(), length );
+		auto rule = m_ttls.find( prefix );
+		if ( rule != m_ttls.end() )
+			return rule->second;
+	}
+	return m_defaultTtl;
+
+}
+
+}
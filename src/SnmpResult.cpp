@@ -0,0 +1,156 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <SnmpResult.h>
+
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+
+namespace Snmp
+{
+
+Constants::Errors SnmpError::agentError() const
+{
+
+	switch ( errorStatus )
+	{
+		case SNMP_ERR_TOOBIG: return Constants::TOO_BIG;
+		case SNMP_ERR_NOSUCHNAME: return Constants::NO_SUCH_NAME;
+		case SNMP_ERR_BADVALUE: return Constants::BAD_VALUE;
+		case SNMP_ERR_READONLY: return Constants::NOT_WRITABLE;
+		case SNMP_ERR_NOACCESS: return Constants::NO_ACCESS;
+		case SNMP_ERR_WRONGTYPE: return Constants::WRONG_TYPE;
+		case SNMP_ERR_WRONGLENGTH: return Constants::WRONG_LENGTH;
+		case SNMP_ERR_WRONGENCODING: return Constants::WRONG_ENCODING;
+		case SNMP_ERR_WRONGVALUE: return Constants::WRONG_VALUE;
+		case SNMP_ERR_NOCREATION: return Constants::NO_CREATION;
+		case SNMP_ERR_INCONSISTENTVALUE: return Constants::INCONSISTENT_VALUE;
+		case SNMP_ERR_RESOURCEUNAVAILABLE: return Constants::RESOURCE_UNAVAILABLE;
+		case SNMP_ERR_COMMITFAILED: return Constants::COMMIT_FAILED;
+		case SNMP_ERR_UNDOFAILED: return Constants::UNDO_FAILED;
+		case SNMP_ERR_AUTHORIZATIONERROR: return Constants::NO_ACCESS;
+		case SNMP_ERR_NOTWRITABLE: return Constants::NOT_WRITABLE;
+		case SNMP_ERR_INCONSISTENTNAME: return Constants::INCONSISTENT_NAME;
+		default: return Constants::GENERIC_ERROR;
+	}
+
+}
+
+SnmpStatus SnmpError::status() const
+{
+
+	switch ( kind )
+	{
+		case Kind::None: return Snmp_Good;
+		case Kind::Timeout: return Snmp_BadTimeout;
+		case Kind::SendError: return Snmp_BadCommunicationError;
+		case Kind::CircuitOpen: return Snmp_BadNoCommunication;
+		// as the typed getters report these
+		case Kind::Exception: return Snmp_BadNoDataAvailable;
+		case Kind::WrongType: return Snmp_BadNoDataAvailable;
+		case Kind::AgentError: return Snmp_Bad;
+		case Kind::InvalidOid: return Snmp_Bad;
+		case Kind::NotApplied: return Snmp_Bad;
+	}
+	return Snmp_Bad;
+
+}
+
+std::string SnmpError::toString() const
+{
+
+	switch ( kind )
+	{
+		case Kind::AgentError:
+			return std::string( kindToString( kind ) ) + ": " + snmp_errstring( errorStatus ) + " at varbind " + std::to_string( errorIndex );
+		case Kind::Exception:
+			switch ( exception )
+			{
+				case Constants::NO_SUCH_OBJECT: return "noSuchObject";
+				case Constants::NO_SUCH_INSTANCE: return "noSuchInstance";
+				case Constants::END_OF_MIB_VIEW: return "endOfMibView";
+			}
+			return kindToString( kind );
+		default:
+			return kindToString( kind );
+	}
+
+}
+
+const char * SnmpError::kindToString( Kind kind )
+{
+
+	switch ( kind )
+	{
+		case Kind::None: return "no error";
+		case Kind::Timeout: return "timeout";
+		case Kind::SendError: return "send error";
+		case Kind::CircuitOpen: return "circuit breaker open";
+		case Kind::AgentError: return "agent error";
+		case Kind::Exception: return "exception value";
+		case Kind::WrongType: return "unexpected type";
+		case Kind::InvalidOid: return "invalid OID";
+		case Kind::NotApplied: return "not applied";
+	}
+	return "unknown";
+
+}
+
+SnmpError SnmpError::agent( long errorStatus, long errorIndex )
+{
+
+	SnmpError error;
+	error.kind = Kind::AgentError;
+	error.errorStatus = errorStatus;
+	error.errorIndex = errorIndex;
+	return error;
+
+}
+
+SnmpError SnmpError::exceptionValue( Constants::Exceptions exception )
+{
+
+	SnmpError error;
+	error.kind = Kind::Exception;
+	error.exception = exception;
+	return error;
+
+}
+
+SnmpError SnmpError::of( Kind kind )
+{
+
+	SnmpError error;
+	error.kind = kind;
+	return error;
+
+}
+
+} // Snmp
@@ -0,0 +1,106 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <SnmpSessionPool.h>
+
+#include <net-snmp/net-snmp-config.h>
+#include <net-snmp/net-snmp-includes.h>
+
+namespace Snmp
+{
+
+void SnmpSessionPool::add( void * sessp )
+{
+
+	auto slot = std::make_unique<Slot>();
+	slot->sessp = sessp;
+	m_slots.push_back( std::move(slot) );
+
+}
+
+void SnmpSessionPool::closeAll()
+{
+
+	for ( auto& slot : m_slots )
+		snmp_sess_close( slot->sessp );
+	m_slots.clear();
+
+}
+
+SnmpSessionPool::Lease SnmpSessionPool::acquire()
+{
+
+	size_t slot;
+	if ( tryAcquire(slot) )
+		return Lease( *this, slot );
+
+	std::unique_lock<std::mutex> lock(m_waitMutex);
+	m_waiters++;
+	m_released.wait( lock, [this, &slot] { return tryAcquire(slot); } );
+	m_waiters--;
+
+	return Lease( *this, slot );
+
+}
+
+bool SnmpSessionPool::tryAcquire( size_t& slot )
+{
+
+	const size_t sessions = m_slots.size();
+	const size_t first = m_next++;
+
+	for ( size_t i = 0; i < sessions; i++ )
+	{
+		const size_t candidate = (first + i) % sessions;
+		bool expected = false;
+		if ( m_slots[candidate]->busy.compare_exchange_strong( expected, true ) )
+		{
+			slot = candidate;
+			return true;
+		}
+	}
+	return false;
+
+}
+
+void SnmpSessionPool::release( size_t slot )
+{
+
+	m_slots[slot]->busy = false;
+
+	if ( m_waiters > 0 )
+	{
+		std::lock_guard<std::mutex> guard(m_waitMutex);
+		m_released.notify_one();
+	}
+
+}
+
+}
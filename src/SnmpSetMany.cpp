@@ -0,0 +1,184 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <SnmpBackend.h>
+#include <MuleLogComponents.h>
+
+namespace Snmp
+{
+
+using Mule::LogComponentLevels;
+
+std::vector<SnmpError> SnmpBackend::snmpSetMany( const std::vector<std::pair<std::string, snmpSetValue>>& varbinds, bool atomic )
+{
+
+	std::vector<std::pair<Oid, snmpSetValue>> prepared;
+	std::vector<size_t> positions;
+	std::vector<SnmpError> results( varbinds.size(), SnmpError::of( SnmpError::Kind::NotApplied ) );
+
+	for ( size_t i = 0; i < varbinds.size(); i++ )
+	{
+		Oid subIdentifierList;
+		if ( !tryPrepareOid( varbinds[i].first, subIdentifierList, results[i] ) )
+		{
+			// All or nothing: nothing is sent when one of them cannot be
+			if ( atomic )
+				return results;
+			continue;
+		}
+		prepared.emplace_back( subIdentifierList, varbinds[i].second );
+		positions.push_back( i );
+	}
+
+	const std::vector<SnmpError> preparedResults = snmpSetMany( prepared, atomic );
+	for ( size_t i = 0; i < positions.size(); i++ )
+		results[ positions[i] ] = preparedResults[i];
+
+	return results;
+
+}
+
+std::vector<SnmpError> SnmpBackend::snmpSetMany( const std::vector<std::pair<Oid, snmpSetValue>>& varbinds, bool atomic )
+{
+
+	LOG(Log::TRC, LogComponentLevels::mule()) << "SNMP set of " << varbinds.size() << " OIDs" << (atomic ? " (atomic)" : "") << " on device with hostname: " << m_hostname;
+
+	std::vector<SnmpError> results( varbinds.size(), SnmpError::of( SnmpError::Kind::NotApplied ) );
+
+	if ( isCircuitOpen() )
+	{
+		results.assign( varbinds.size(), SnmpError::of( SnmpError::Kind::CircuitOpen ) );
+		return results;
+	}
+
+	std::vector<size_t> indices( varbinds.size() );
+	for ( size_t i = 0; i < indices.size(); i++ )
+		indices[i] = i;
+
+	if ( atomic )
+	{
+		if ( !indices.empty() )
+			snmpSetBatch( varbinds, indices, true, results );
+		return results;
+	}
+
+	size_t first = 0;
+	while ( first < indices.size() )
+	{
+		const size_t batchSize = std::min<size_t>( m_maxSetVarbindsPerPdu, indices.size() - first );
+		const std::vector<size_t> batch( indices.begin() + first, indices.begin() + first + batchSize );
+		first += batchSize;
+
+		// The rest stays not applied, no point in sending it to a device which does not answer
+		if ( !snmpSetBatch( varbinds, batch, false, results ) )
+			break;
+	}
+
+	return results;
+
+}
+
+bool SnmpBackend::snmpSetBatch ( const std::vector<std::pair<Oid, snmpSetValue>>& varbinds,
+				const std::vector<size_t>& indices,
+				bool atomic,
+				std::vector<SnmpError>& results )
+{
+
+	netsnmp_pdu *pdu = snmp_pdu_create(SNMP_MSG_SET);
+
+	std::vector<size_t> encoded;
+	for ( const size_t index : indices )
+	{
+		if ( addSetVarbind( pdu, varbinds[index].first, varbinds[index].second ) == Snmp_Good )
+			encoded.push_back( index );
+		else
+			results[index] = SnmpError::of( SnmpError::Kind::WrongType );
+	}
+
+	if ( encoded.empty() || ( atomic && encoded.size() != indices.size() ) )
+	{
+		snmp_free_pdu( pdu );
+		return true;
+	}
+
+	LOG(Log::TRC, LogComponentLevels::mule()) << "Sending SET request with " << encoded.size() << " varbinds";
+
+	netsnmp_pdu *response = nullptr;
+	const int snmp_status = synchResponse( pdu, &response );
+	PduPtr responseGuard( response );
+
+	const SnmpError error = responseError( snmp_status, response );
+
+	if ( !error )
+	{
+		for ( const size_t index : encoded )
+			results[index] = SnmpError();
+		return true;
+	}
+
+	if ( error.kind != SnmpError::Kind::AgentError )
+	{
+		LOG(Log::DBG, LogComponentLevels::mule()) << "[" << m_hostname << "] " << "SET of " << encoded.size() << " varbinds failed, " << error.toString();
+		for ( const size_t index : encoded )
+			results[index] = error;
+		return false;
+	}
+
+	if ( !atomic && error.errorStatus == SNMP_ERR_TOOBIG && encoded.size() > 1 )
+	{
+		const size_t half = encoded.size() / 2;
+		LOG(Log::DBG, LogComponentLevels::mule()) << "[" << m_hostname << "] " << "SET PDU with " << encoded.size() << " varbinds is too big, splitting";
+
+		size_t expected = m_maxSetVarbindsPerPdu;
+		while ( expected > half && !m_maxSetVarbindsPerPdu.compare_exchange_weak( expected, half ) ) {}
+
+		const std::vector<size_t> lower( encoded.begin(), encoded.begin() + half );
+		const std::vector<size_t> upper( encoded.begin() + half, encoded.end() );
+		return snmpSetBatch( varbinds, lower, false, results ) && snmpSetBatch( varbinds, upper, false, results );
+	}
+
+	// A refused SET PDU is applied not at all, the varbind it is refused for takes the blame
+	const bool blamed = error.errorIndex >= 1 && static_cast<size_t>(error.errorIndex) <= encoded.size();
+	for ( size_t i = 0; i < encoded.size(); i++ )
+		if ( !blamed || i == static_cast<size_t>(error.errorIndex - 1) )
+			results[ encoded[i] ] = error;
+
+	LOG(Log::DBG, LogComponentLevels::mule()) << "[" << m_hostname << "] " << "SET of " << encoded.size() << " varbinds refused, " << error.toString();
+
+	if ( atomic || !blamed )
+		return true;
+
+	std::vector<size_t> remaining( encoded );
+	remaining.erase( remaining.begin() + (error.errorIndex - 1) );
+	return remaining.empty() || snmpSetBatch( varbinds, remaining, false, results );
+
+}
+
+} // Snmp
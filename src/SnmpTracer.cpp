@@ -0,0 +1,400 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <SnmpTracer.h>
+#include <SnmpExceptions.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+
+namespace Snmp
+{
+
+namespace
+{
+
+uint64_t nowNs()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+size_t roundUpToPowerOfTwo( size_t value )
+{
+	size_t rounded = 1;
+	while ( rounded < value )
+		rounded <<= 1;
+	return rounded;
+}
+
+// Name of the slice ending at phase
+const char * stageName( SnmpTracer::Phase phase )
+{
+	switch ( phase )
+	{
+		case SnmpTracer::Phase::Enqueued: return "enqueue";
+		case SnmpTracer::Phase::OidPrepared: return "oid parsing";
+		case SnmpTracer::Phase::SessionAcquired: return "session wait";
+		case SnmpTracer::Phase::Received: return "round trip";
+		case SnmpTracer::Phase::Decoded: return "decoding";
+	}
+	return "unknown";
+}
+
+std::string escapeJson( const std::string& text )
+{
+	std::string escaped;
+	for ( const char c : text )
+	{
+		if ( c == '"' || c == '\\' )
+			escaped += '\\';
+		if ( static_cast<unsigned char>(c) >= 0x20 )
+			escaped += c;
+	}
+	return escaped;
+}
+
+}
+
+/*
+ *	Single producer ring: only the owning thread writes, dumps read. Slots are atomics so that a
+ *	dump racing with the writer reads stale or torn events rather than undefined behaviour; head
+ *	tells which of them can be trusted.
+ */
+struct SnmpTracer::Ring
+{
+	struct Slot
+	{
+		std::atomic<uint64_t> timestampNs{0};
+		std::atomic<uint64_t> requestId{0};
+		// device << 8 | phase
+		std::atomic<uint64_t> devicePhase{0};
+	};
+
+	Ring( uint32_t threadNumber, size_t capacity ) :
+		thread(threadNumber), mask(capacity - 1), slots(new Slot[capacity]), head(0), inUse(true) {}
+
+	void record( uint64_t requestId, uint32_t device, Phase phase )
+	{
+		const uint64_t position = head.load( std::memory_order_relaxed );
+		Slot& slot = slots[position & mask];
+		slot.timestampNs.store( nowNs(), std::memory_order_relaxed );
+		slot.requestId.store( requestId, std::memory_order_relaxed );
+		slot.devicePhase.store( static_cast<uint64_t>(device) << 8 | static_cast<uint8_t>(phase), std::memory_order_relaxed );
+		head.store( position + 1, std::memory_order_release );
+		currentPhase = phase;
+	}
+
+	const uint32_t thread;
+	const uint64_t mask;
+	const std::unique_ptr<Slot[]> slots;
+	// events written so far
+	std::atomic<uint64_t> head;
+	// owned by a running thread, free rings are taken over by new threads
+	std::atomic<bool> inUse;
+
+	// Touched by the owning thread only
+	uint64_t requestsStarted = 0;
+	uint64_t currentRequest = 0;
+	uint32_t currentDevice = 0;
+	Phase currentPhase = Phase::Decoded;
+};
+
+SnmpTracer& SnmpTracer::instance()
+{
+
+	static SnmpTracer tracer;
+	return tracer;
+
+}
+
+SnmpTracer::SnmpTracer() :
+	m_enabled(false),
+	m_eventsPerThread(Constants::SNMP_TRACE_EVENTS_PER_THREAD)
+{}
+
+SnmpTracer::~SnmpTracer() = default;
+
+void SnmpTracer::enable( size_t eventsPerThread )
+{
+
+	m_eventsPerThread = roundUpToPowerOfTwo( std::max<size_t>( eventsPerThread, 2 ) );
+	m_enabled = true;
+
+}
+
+void SnmpTracer::disable()
+{
+
+	m_enabled = false;
+
+}
+
+uint32_t SnmpTracer::registerDevice( const std::string& name )
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	auto device = m_deviceNumbers.find( name );
+	if ( device != m_deviceNumbers.end() )
+		return device->second;
+
+	m_devices.push_back( name );
+	m_deviceNumbers[name] = m_devices.size() - 1;
+	return m_devices.size() - 1;
+
+}
+
+SnmpTracer::Ring& SnmpTracer::threadRing()
+{
+
+	// Hands the ring back when the thread exits
+	struct Owner
+	{
+		Ring * ring = nullptr;
+		~Owner()
+		{
+			if ( !ring )
+				return;
+			ring->currentRequest = 0;
+			ring->inUse.store( false, std::memory_order_release );
+		}
+	};
+
+	thread_local Owner owner;
+	if ( !owner.ring )
+	{
+		const size_t capacity = m_eventsPerThread;
+
+		std::lock_guard<std::mutex> guard(m_mutex);
+		for ( const auto& ring : m_rings )
+		{
+			if ( ring->mask + 1 == capacity && !ring->inUse.load( std::memory_order_acquire ) )
+			{
+				ring->inUse.store( true, std::memory_order_relaxed );
+				owner.ring = ring.get();
+				break;
+			}
+		}
+		if ( !owner.ring )
+		{
+			m_rings.push_back( std::unique_ptr<Ring>( new Ring( m_rings.size(), capacity ) ) );
+			owner.ring = m_rings.back().get();
+		}
+	}
+	return *owner.ring;
+
+}
+
+void SnmpTracer::beginRequest( uint32_t device )
+{
+
+	Ring& ring = threadRing();
+	// Thread number in the high bits keeps ids unique without a shared counter
+	ring.currentRequest = (static_cast<uint64_t>(ring.thread) + 1) << 40 | ++ring.requestsStarted;
+	ring.currentDevice = device;
+	ring.record( ring.currentRequest, device, Phase::Enqueued );
+
+}
+
+void SnmpTracer::enqueueRequest( uint32_t device )
+{
+
+	Ring& ring = threadRing();
+	if ( ring.currentRequest && ring.currentDevice == device && ring.currentPhase == Phase::OidPrepared )
+		return;
+	beginRequest( device );
+
+}
+
+void SnmpTracer::markRequest( Phase phase )
+{
+
+	Ring& ring = threadRing();
+	if ( ring.currentRequest && phase > ring.currentPhase )
+		ring.record( ring.currentRequest, ring.currentDevice, phase );
+
+}
+
+std::vector<SnmpTracer::Event> SnmpTracer::snapshot() const
+{
+
+	std::vector<Event> events;
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	for ( const auto& ring : m_rings )
+	{
+		const uint64_t capacity = ring->mask + 1;
+		const uint64_t head = ring->head.load( std::memory_order_acquire );
+		const uint64_t first = head > capacity ? head - capacity : 0;
+		const size_t copied = events.size();
+
+		for ( uint64_t position = first; position < head; position++ )
+		{
+			const Ring::Slot& slot = ring->slots[position & ring->mask];
+			const uint64_t devicePhase = slot.devicePhase.load( std::memory_order_relaxed );
+			events.push_back( Event{
+				slot.timestampNs.load( std::memory_order_relaxed ),
+				slot.requestId.load( std::memory_order_relaxed ),
+				static_cast<uint32_t>( devicePhase >> 8 ),
+				ring->thread,
+				static_cast<Phase>( devicePhase & 0xff ) } );
+		}
+
+		// Drop what the writer may have been overwriting meanwhile, the slot it is on included
+		std::atomic_thread_fence( std::memory_order_acquire );
+		const uint64_t headAfter = ring->head.load( std::memory_order_relaxed );
+		const uint64_t firstIntact = headAfter >= capacity ? headAfter - capacity + 1 : 0;
+		if ( firstIntact > first )
+		{
+			const size_t torn = std::min<uint64_t>( firstIntact - first, head - first );
+			events.erase( events.begin() + copied, events.begin() + copied + torn );
+		}
+	}
+
+	std::sort( events.begin(), events.end(), [] ( const Event& a, const Event& b ) { return a.timestampNs < b.timestampNs; } );
+	return events;
+
+}
+
+std::vector<std::string> SnmpTracer::deviceNames() const
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	return m_devices;
+
+}
+
+size_t SnmpTracer::dumpChromeTrace( const std::string& path ) const
+{
+
+	const std::vector<Event> events = snapshot();
+	const std::vector<std::string> devices = deviceNames();
+
+	std::ofstream output( path );
+	if ( !output )
+		snmp_throw_runtime_error_with_origin("Cannot open trace file " + path);
+
+	// Events of each request, in time order
+	std::map<uint64_t, std::vector<const Event*>> requests;
+	for ( const Event& event : events )
+		requests[event.requestId].push_back( &event );
+
+	const uint64_t origin = events.empty() ? 0 : events.front().timestampNs;
+	auto microseconds = [origin] ( uint64_t timestampNs ) { return (timestampNs - origin) / 1000.0; };
+
+	output << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+	const char * separator = "";
+	for ( const auto& request : requests )
+	{
+		const std::vector<const Event*>& phases = request.second;
+		const Event& first = *phases.front();
+		const std::string device = first.device < devices.size() ? escapeJson( devices[first.device] ) : std::to_string( first.device );
+
+		output << separator << "\n{\"name\":\"request\",\"ph\":\"X\",\"pid\":1,\"tid\":" << first.thread
+			<< ",\"ts\":" << microseconds( first.timestampNs )
+			<< ",\"dur\":" << microseconds( phases.back()->timestampNs ) - microseconds( first.timestampNs )
+			<< ",\"args\":{\"device\":\"" << device << "\",\"id\":" << request.first << "}}";
+		separator = ",";
+
+		for ( size_t i = 1; i < phases.size(); i++ )
+		{
+			output << ",\n{\"name\":\"" << stageName( phases[i]->phase ) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << first.thread
+				<< ",\"ts\":" << microseconds( phases[i - 1]->timestampNs )
+				<< ",\"dur\":" << microseconds( phases[i]->timestampNs ) - microseconds( phases[i - 1]->timestampNs ) << "}";
+		}
+	}
+	output << "\n]}\n";
+
+	if ( !output )
+		snmp_throw_runtime_error_with_origin("Failed writing trace file " + path);
+
+	return events.size();
+
+}
+
+size_t SnmpTracer::dumpBinary( const std::string& path ) const
+{
+
+	const std::vector<Event> events = snapshot();
+	const std::vector<std::string> devices = deviceNames();
+
+	std::ofstream output( path, std::ios::binary );
+	if ( !output )
+		snmp_throw_runtime_error_with_origin("Cannot open trace file " + path);
+
+	auto write = [&output] ( const void * data, size_t length ) { output.write( static_cast<const char*>(data), length ); };
+
+	write( "MULETRC1", 8 );
+	const uint32_t deviceCount = devices.size();
+	write( &deviceCount, sizeof deviceCount );
+	for ( const std::string& device : devices )
+	{
+		const uint16_t length = std::min<size_t>( device.size(), UINT16_MAX );
+		write( &length, sizeof length );
+		write( device.data(), length );
+	}
+
+	const uint64_t eventCount = events.size();
+	write( &eventCount, sizeof eventCount );
+	for ( const Event& event : events )
+	{
+		const uint8_t phaseAndPadding[8] = { static_cast<uint8_t>(event.phase) };
+		write( &event.timestampNs, sizeof event.timestampNs );
+		write( &event.requestId, sizeof event.requestId );
+		write( &event.device, sizeof event.device );
+		write( &event.thread, sizeof event.thread );
+		write( phaseAndPadding, sizeof phaseAndPadding );
+	}
+
+	if ( !output )
+		snmp_throw_runtime_error_with_origin("Failed writing trace file " + path);
+
+	return events.size();
+
+}
+
+const char * SnmpTracer::phaseToString( Phase phase )
+{
+
+	switch ( phase )
+	{
+		case Phase::Enqueued: return "enqueued";
+		case Phase::OidPrepared: return "oid prepared";
+		case Phase::SessionAcquired: return "session acquired";
+		case Phase::Received: return "received";
+		case Phase::Decoded: return "decoded";
+	}
+	return "unknown";
+
+}
+
+} // Snmp
@@ -0,0 +1,437 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <SnmpTrapReceiver.h>
+#include <SnmpLibrary.h>
+#include <SnmpExceptions.h>
+#include <MuleLogComponents.h>
+
+#include <algorithm>
+#include <cerrno>
+
+#include <poll.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+using Mule::LogComponentLevels;
+
+namespace Snmp
+{
+
+/*
+ *	sysUpTime.0, snmpTrapOID.0 and snmpTraps from SNMPv2-MIB, needed to read notifications
+ *	without any MIB loaded
+ */
+static const oid SYS_UP_TIME_0[] = { 1, 3, 6, 1, 2, 1, 1, 3, 0 };
+static const oid SNMP_TRAP_OID_0[] = { 1, 3, 6, 1, 6, 3, 1, 1, 4, 1, 0 };
+static const oid SNMP_TRAPS[] = { 1, 3, 6, 1, 6, 3, 1, 1, 5 };
+
+/*
+ *	SNMPv1 generic trap number of enterpriseSpecific
+ */
+static const long SNMP_V1_ENTERPRISE_SPECIFIC = 6;
+
+SnmpTrapReceiver::SnmpTrapReceiver( const SnmpTrapReceiverOptions& options ) :
+				m_communities(options.communities),
+				m_port(options.port),
+				m_nextHandlerId(1),
+				m_received(0),
+				m_informsAcknowledged(0),
+				m_dropped(0),
+				m_handlerPool(std::max<size_t>(options.handlerThreads, 1)),
+				m_sessp(nullptr),
+				m_running(true)
+{
+
+	SnmpLibrary::initialize();
+
+	for ( const auto& user : options.users )
+		createUser( user );
+
+	openTransport( options );
+
+	if ( pipe(m_wakeUpPipe) != 0 )
+	{
+		snmp_sess_close( m_sessp );
+		snmp_throw_runtime_error_with_origin("Failed to create the wake up pipe of the trap receiver");
+	}
+
+	fcntl( m_wakeUpPipe[0], F_SETFL, O_NONBLOCK );
+	fcntl( m_wakeUpPipe[1], F_SETFL, O_NONBLOCK );
+
+	m_thread = std::thread( &SnmpTrapReceiver::eventLoop, this );
+
+}
+
+SnmpTrapReceiver::~SnmpTrapReceiver()
+{
+
+	m_running = false;
+	wakeUp();
+	m_thread.join();
+
+	snmp_sess_close( m_sessp );
+	close( m_wakeUpPipe[0] );
+	close( m_wakeUpPipe[1] );
+
+}
+
+void SnmpTrapReceiver::createUser( const SnmpTrapUser& user )
+{
+
+	if ( user.username.empty() )
+		snmp_throw_runtime_error_with_origin("SNMPv3 trap user without user name");
+
+	/*
+	 *	Same syntax as the createUser directive of snmptrapd.conf, the library localizes the keys
+	 *	with the given engine ID, or with the local one for informs
+	 */
+	std::string line;
+	if ( !user.engineId.empty() )
+		line += "-e " + user.engineId + " ";
+	line += user.username;
+
+	if ( user.securityLevel == "authNoPriv" || user.securityLevel == "authPriv" )
+		line += " " + user.authenticationProtocol + " \"" + user.authenticationPassPhrase + "\"";
+	if ( user.securityLevel == "authPriv" )
+		line += " " + user.privacyProtocol + " \"" + user.privacyPassPhrase + "\"";
+	if ( user.securityLevel != "noAuthNoPriv" && user.securityLevel != "authNoPriv" && user.securityLevel != "authPriv" )
+		snmp_throw_runtime_error_with_origin("invalid security level string received [" + user.securityLevel + "], valid options are [noAuthNoPriv|authNoPriv|authPriv]");
+
+	LOG(Log::INF, LogComponentLevels::mule()) << "Accepting notifications from SNMPv3 user [" << user.username << "], security level [" << user.securityLevel << "]";
+
+	// The parser tokenizes in place
+	std::vector<char> buffer( line.begin(), line.end() );
+	buffer.push_back( '\0' );
+	usm_parse_create_usmUser( "createUser", buffer.data() );
+
+}
+
+void SnmpTrapReceiver::openTransport( const SnmpTrapReceiverOptions& options )
+{
+
+	const std::string endpoint = "udp:" + options.address + ":" + std::to_string( options.port );
+
+	netsnmp_transport * transport = netsnmp_transport_open_server( "snmptrap", endpoint.c_str() );
+	if ( !transport )
+		snmp_throw_runtime_error_with_origin("Failed to listen for notifications on " + endpoint);
+
+	/*
+	 *	Port 0 is bound to an ephemeral port, tell which one
+	 */
+	sockaddr_in local;
+	socklen_t localLength = sizeof local;
+	if ( getsockname( transport->sock, reinterpret_cast<sockaddr*>(&local), &localLength ) == 0 && local.sin_family == AF_INET )
+		m_port = ntohs( local.sin_port );
+
+	snmp_session session;
+	snmp_sess_init( &session );
+	session.callback = &SnmpTrapReceiver::notificationCallback;
+	session.callback_magic = this;
+	// Authoritative for informs, not for traps, as snmptrapd
+	session.isAuthoritative = SNMP_SESS_UNKNOWNAUTH;
+
+	// Owns the transport from now on, also on failure
+	m_sessp = snmp_sess_add( &session, transport, nullptr, nullptr );
+	if ( !m_sessp )
+	{
+		snmp_perror("ack");
+		snmp_throw_runtime_error_with_origin("Failed to open the notification session on " + endpoint);
+	}
+
+	LOG(Log::INF, LogComponentLevels::mule()) << "Listening for SNMP notifications on " << options.address << ":" << m_port;
+
+}
+
+SnmpTrapReceiver::HandlerId SnmpTrapReceiver::addHandler( const Oid& trapOidPrefix, Handler handler )
+{
+
+	std::unique_lock<std::shared_mutex> guard(m_handlerMutex);
+	const HandlerId id = m_nextHandlerId++;
+	m_handlers.push_back( Registration{ id, trapOidPrefix, std::move(handler) } );
+	return id;
+
+}
+
+void SnmpTrapReceiver::removeHandler( HandlerId id )
+{
+
+	std::unique_lock<std::shared_mutex> guard(m_handlerMutex);
+	m_handlers.erase( std::remove_if( m_handlers.begin(), m_handlers.end(),
+		[id] ( const Registration& registration ) { return registration.id == id; } ), m_handlers.end() );
+
+}
+
+SnmpTrapReceiver::Statistics SnmpTrapReceiver::getStatistics() const
+{
+
+	Statistics statistics;
+	statistics.received = m_received;
+	statistics.informsAcknowledged = m_informsAcknowledged;
+	statistics.dropped = m_dropped;
+	return statistics;
+
+}
+
+void SnmpTrapReceiver::wakeUp()
+{
+
+	const char byte = 0;
+	// A full pipe already guarantees a wake up, nothing to do on failure
+	if ( write( m_wakeUpPipe[1], &byte, 1 ) < 0 ) {}
+
+}
+
+void SnmpTrapReceiver::eventLoop()
+{
+
+	netsnmp_transport * transport = snmp_sess_transport( m_sessp );
+
+	pollfd pollFds[2] = { { m_wakeUpPipe[0], POLLIN, 0 }, { transport->sock, POLLIN, 0 } };
+
+	while ( m_running )
+	{
+
+		if ( poll( pollFds, 2, -1 ) < 0 )
+		{
+			if ( errno != EINTR )
+			{
+				LOG(Log::ERR, LogComponentLevels::mule()) << "SNMP trap receiver poll failed, errno: " << errno;
+				std::this_thread::sleep_for( std::chrono::milliseconds(10) );
+			}
+			continue;
+		}
+
+		if ( pollFds[0].revents & POLLIN )
+		{
+			char buffer[64];
+			while ( read( m_wakeUpPipe[0], buffer, sizeof buffer ) > 0 ) {}
+		}
+
+		if ( pollFds[1].revents & (POLLIN | POLLERR) )
+		{
+			netsnmp_large_fd_set readFds;
+			netsnmp_large_fd_set_init( &readFds, pollFds[1].fd + 1 );
+			NETSNMP_LARGE_FD_SET( pollFds[1].fd, &readFds );
+			snmp_sess_read2( m_sessp, &readFds );
+			netsnmp_large_fd_set_cleanup( &readFds );
+		}
+
+	}
+
+}
+
+int SnmpTrapReceiver::notificationCallback( int operation, netsnmp_session * /*session*/, int /*reqid*/, netsnmp_pdu *pdu, void *magic )
+{
+
+	if ( operation == NETSNMP_CALLBACK_OP_RECEIVED_MESSAGE )
+		static_cast<SnmpTrapReceiver*>( magic )->processNotification( pdu );
+
+	// The library frees the PDU once we return
+	return 1;
+
+}
+
+void SnmpTrapReceiver::processNotification( netsnmp_pdu * pdu )
+{
+
+	m_received++;
+
+	if ( pdu->command != SNMP_MSG_TRAP && pdu->command != SNMP_MSG_TRAP2 && pdu->command != SNMP_MSG_INFORM )
+	{
+		LOG(Log::TRC, LogComponentLevels::mule()) << "Dropping PDU of type 0x" << std::hex << pdu->command << " received on the trap port";
+		m_dropped++;
+		return;
+	}
+
+	if ( !isCommunityAccepted( pdu ) )
+	{
+		LOG(Log::WRN, LogComponentLevels::mule()) << "Dropping notification with unknown community";
+		m_dropped++;
+		return;
+	}
+
+	if ( pdu->command == SNMP_MSG_INFORM && acknowledgeInform( pdu ) )
+		m_informsAcknowledged++;
+
+	try
+	{
+		dispatch( decodeNotification( pdu ) );
+	}
+	catch (const std::exception& e)
+	{
+		LOG(Log::ERR, LogComponentLevels::mule()) << "Failed to process notification: " << e.what();
+	}
+
+}
+
+bool SnmpTrapReceiver::isCommunityAccepted( const netsnmp_pdu * pdu ) const
+{
+
+	// SNMPv3 users are authenticated by the library
+	if ( pdu->version == SNMP_VERSION_3 || m_communities.empty() )
+		return true;
+
+	const std::string community( reinterpret_cast<const char*>(pdu->community), pdu->community_len );
+	return std::find( m_communities.begin(), m_communities.end(), community ) != m_communities.end();
+
+}
+
+bool SnmpTrapReceiver::acknowledgeInform( netsnmp_pdu * pdu )
+{
+
+	/*
+	 *	The response echoes the request id and varbinds, and goes back to the transport address
+	 *	the inform came from
+	 */
+	netsnmp_pdu * reply = snmp_clone_pdu( pdu );
+	if ( !reply )
+		return false;
+
+	reply->command = SNMP_MSG_RESPONSE;
+	reply->errstat = SNMP_ERR_NOERROR;
+	reply->errindex = 0;
+
+	if ( snmp_sess_send( m_sessp, reply ) == 0 )
+	{
+		snmp_perror("ack");
+		LOG(Log::ERR, LogComponentLevels::mule()) << "Failed to acknowledge inform " << pdu->reqid;
+		snmp_free_pdu( reply );
+		return false;
+	}
+
+	return true;
+
+}
+
+std::shared_ptr<SnmpNotification> SnmpTrapReceiver::decodeNotification( netsnmp_pdu * pdu )
+{
+
+	auto notification = std::make_shared<SnmpNotification>();
+
+	notification->type = pdu->command == SNMP_MSG_INFORM ? Snmp::Constants::INFORM : Snmp::Constants::TRAP;
+
+	switch ( pdu->version )
+	{
+		case SNMP_VERSION_1: notification->version = "1"; break;
+		case SNMP_VERSION_3: notification->version = "3"; break;
+		default: notification->version = "2c"; break;
+	}
+
+	if ( pdu->version == SNMP_VERSION_3 )
+		notification->securityName.assign( pdu->securityName ? pdu->securityName : "", pdu->securityNameLen );
+	else
+		notification->securityName.assign( reinterpret_cast<const char*>(pdu->community), pdu->community_len );
+
+	char * source = netsnmp_transport_peer_string( snmp_sess_transport( m_sessp ), pdu->transport_data, pdu->transport_data_length );
+	if ( source )
+	{
+		notification->source = source;
+		free( source );
+	}
+
+	if ( pdu->command == SNMP_MSG_TRAP )
+	{
+		/*
+		 *	RFC 3584 3.1: generic traps map to snmpTraps.(generic + 1), enterprise specific ones
+		 *	to enterprise.0.specific
+		 */
+		notification->upTime = static_cast<uint32_t>( pdu->time );
+		if ( pdu->trap_type == SNMP_V1_ENTERPRISE_SPECIFIC )
+		{
+			notification->trapOid.assign( pdu->enterprise, pdu->enterprise_length );
+			notification->trapOid.append( 0 );
+			notification->trapOid.append( static_cast<oid>( pdu->specific_type ) );
+		}
+		else
+		{
+			notification->trapOid.assign( SNMP_TRAPS, sizeof SNMP_TRAPS / sizeof(oid) );
+			notification->trapOid.append( static_cast<oid>( pdu->trap_type + 1 ) );
+		}
+	}
+
+	const Oid sysUpTime( SYS_UP_TIME_0, sizeof SYS_UP_TIME_0 / sizeof(oid) );
+	const Oid snmpTrapOid( SNMP_TRAP_OID_0, sizeof SNMP_TRAP_OID_0 / sizeof(oid) );
+
+	for ( netsnmp_variable_list * vars = pdu->variables; vars; vars = vars->next_variable )
+	{
+
+		const Oid name( vars->name, vars->name_length );
+
+		if ( pdu->command != SNMP_MSG_TRAP && vars->type == ASN_TIMETICKS && name == sysUpTime )
+		{
+			notification->upTime = static_cast<uint32_t>( *vars->val.integer );
+			continue;
+		}
+
+		if ( pdu->command != SNMP_MSG_TRAP && vars->type == ASN_OBJECT_ID && name == snmpTrapOid )
+		{
+			notification->trapOid.assign( vars->val.objid, vars->val_len / sizeof(oid) );
+			continue;
+		}
+
+		if ( vars->type == ASN_OBJECT_ID )
+		{
+			const Oid value( vars->val.objid, vars->val_len / sizeof(oid) );
+			notification->varbinds.push_back( SnmpNotification::Varbind{ name, Snmp_Good, value.getOidString() } );
+			continue;
+		}
+
+		const auto decoded = SnmpBackend::decodeVariable( vars );
+		notification->varbinds.push_back( SnmpNotification::Varbind{ name, decoded.first, decoded.second } );
+
+	}
+
+	LOG(Log::DBG, LogComponentLevels::mule()) << "Received SNMPv" << notification->version << " notification " << notification->trapOid
+			<< " from " << notification->source << " with " << notification->varbinds.size() << " varbinds";
+
+	return notification;
+
+}
+
+void SnmpTrapReceiver::dispatch( std::shared_ptr<const SnmpNotification> notification )
+{
+
+	std::shared_lock<std::shared_mutex> guard(m_handlerMutex);
+
+	for ( const auto& registration : m_handlers )
+	{
+		if ( !registration.trapOidPrefix.isPrefixOf( notification->trapOid ) )
+			continue;
+
+		Handler handler = registration.handler;
+		m_handlerPool.submit( [handler, notification] () { handler( *notification ); } );
+	}
+
+}
+
+} // Snmp
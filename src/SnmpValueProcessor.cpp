@@ -0,0 +1,197 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <SnmpValueProcessor.h>
+#include <MuleLogComponents.h>
+
+#include <cmath>
+#include <limits>
+
+using Mule::LogComponentLevels;
+
+namespace Snmp
+{
+
+namespace
+{
+
+const uint64_t COUNTER32_MASK = 0xffffffff;
+const uint64_t COUNTER64_MASK = std::numeric_limits<uint64_t>::max();
+
+uint64_t sysUpTimeUs( const TimeTicks& ticks )
+{
+	return static_cast<uint64_t>( ticks.hundredths ) * 10000;
+}
+
+}
+
+void SnmpValueProcessor::setDeadband( const Oid& oidOfInterest, const SnmpDeadband& deadband )
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	m_published[oidOfInterest].deadband = deadband;
+
+}
+
+bool SnmpValueProcessor::shouldPublishNumber( const Oid& oidOfInterest, SnmpStatus status, double value )
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	Published& published = m_published[oidOfInterest];
+
+	bool publish = !published.valid || status != published.status;
+	if ( !publish && status == Snmp_Good )
+	{
+		const double change = std::fabs( value - published.number );
+		const SnmpDeadband& deadband = published.deadband;
+		// NaN compares false, a value becoming or leaving NaN is a change
+		publish = ( std::isnan( value ) != std::isnan( published.number ) ) ||
+			( change > deadband.absolute && change > std::fabs( published.number ) * deadband.percent / 100.0 );
+	}
+
+	if ( publish )
+	{
+		published.status = status;
+		published.number = value;
+		published.valid = true;
+	}
+	return publish;
+
+}
+
+bool SnmpValueProcessor::shouldPublish( const Oid& oidOfInterest, const std::pair<SnmpStatus, std::string>& result )
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	Published& published = m_published[oidOfInterest];
+
+	const bool publish = !published.valid || result.first != published.status ||
+		( result.first == Snmp_Good && result.second != published.text );
+
+	if ( publish )
+	{
+		published.status = result.first;
+		published.text = result.second;
+		published.valid = true;
+	}
+	return publish;
+
+}
+
+std::pair<SnmpStatus, double> SnmpValueProcessor::counterRate( const Oid& counterOid, const std::pair<SnmpStatus, uint32_t>& counter, const std::pair<SnmpStatus, TimeTicks>& sysUpTime )
+{
+
+	return rate( counterOid, counter.first, counter.second, COUNTER32_MASK, sysUpTime.first, sysUpTimeUs( sysUpTime.second ), true );
+
+}
+
+std::pair<SnmpStatus, double> SnmpValueProcessor::counterRate( const Oid& counterOid, const std::pair<SnmpStatus, uint64_t>& counter, const std::pair<SnmpStatus, TimeTicks>& sysUpTime )
+{
+
+	return rate( counterOid, counter.first, counter.second, COUNTER64_MASK, sysUpTime.first, sysUpTimeUs( sysUpTime.second ), true );
+
+}
+
+std::pair<SnmpStatus, double> SnmpValueProcessor::counterRate( const Oid& counterOid, const std::pair<SnmpStatus, uint32_t>& counter )
+{
+
+	return rate( counterOid, counter.first, counter.second, COUNTER32_MASK, Snmp_Good, localTimeUs(), false );
+
+}
+
+std::pair<SnmpStatus, double> SnmpValueProcessor::counterRate( const Oid& counterOid, const std::pair<SnmpStatus, uint64_t>& counter )
+{
+
+	return rate( counterOid, counter.first, counter.second, COUNTER64_MASK, Snmp_Good, localTimeUs(), false );
+
+}
+
+std::pair<SnmpStatus, double> SnmpValueProcessor::rate( const Oid& counterOid, SnmpStatus status, uint64_t value, uint64_t mask, SnmpStatus timeStatus, uint64_t timeUs, bool restartDetection )
+{
+
+	if ( status != Snmp_Good )
+		return std::pair<SnmpStatus, double>(status, 0.0);
+	if ( timeStatus != Snmp_Good )
+		return std::pair<SnmpStatus, double>(timeStatus, 0.0);
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	CounterSample& previous = m_counters[counterOid];
+
+	if ( !previous.valid || ( restartDetection && timeUs < previous.timeUs ) )
+	{
+		if ( previous.valid )
+			LOG(Log::INF, LogComponentLevels::mule()) << "Agent restarted, counter " << counterOid << " starts again";
+		previous = CounterSample{ status, value, timeUs, true };
+		return std::pair<SnmpStatus, double>(Snmp_BadNoDataAvailable, 0.0);
+	}
+
+	// Same sample again, e.g. served from a cache
+	if ( timeUs <= previous.timeUs )
+		return std::pair<SnmpStatus, double>(Snmp_BadNoDataAvailable, 0.0);
+
+	// Modulo the width of the counter, which also covers a single wrap
+	const uint64_t delta = ( value - previous.value ) & mask;
+	const double seconds = ( timeUs - previous.timeUs ) / 1e6;
+
+	previous.value = value;
+	previous.timeUs = timeUs;
+
+	return std::pair<SnmpStatus, double>(Snmp_Good, delta / seconds);
+
+}
+
+void SnmpValueProcessor::reset( const Oid& oidOfInterest )
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	const auto published = m_published.find( oidOfInterest );
+	if ( published != m_published.end() )
+		published->second.valid = false;
+	m_counters.erase( oidOfInterest );
+
+}
+
+void SnmpValueProcessor::clear()
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	m_published.clear();
+	m_counters.clear();
+
+}
+
+uint64_t SnmpValueProcessor::localTimeUs()
+{
+
+	return std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::steady_clock::now().time_since_epoch() ).count();
+
+}
+
+} // Snmp
@@ -0,0 +1,498 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <SnmpWalkSnapshot.h>
+#include <SnmpExceptions.h>
+#include <MuleLogComponents.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using Mule::LogComponentLevels;
+
+namespace Snmp
+{
+
+namespace
+{
+
+const char MAGIC[8] = { 'M', 'U', 'L', 'E', 'W', 'S', 'N', '1' };
+const uint32_t VERSION = 1;
+const uint32_t FLAG_UP_TIME = 1;
+
+const oid SYS_UP_TIME[] = { 1, 3, 6, 1, 2, 1, 1, 3, 0 };
+
+/*
+ *	Value tags of the file, independent of the order of the snmpGetValue alternatives
+ */
+enum ValueTag : uint8_t
+{
+	TAG_NONE = 0,
+	TAG_INT32 = 1,
+	TAG_STRING = 2,
+	TAG_UINT32 = 3,
+	TAG_UINT64 = 4,
+	TAG_IP_ADDRESS = 5,
+	TAG_FLOAT = 6,
+	TAG_DOUBLE = 7
+};
+
+uint64_t wallClockUs()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::system_clock::now().time_since_epoch() ).count();
+}
+
+template <typename T>
+void appendBytes( std::string& bytes, const T& value )
+{
+	bytes.append( reinterpret_cast<const char*>(&value), sizeof value );
+}
+
+uint8_t encodeValue( const snmpGetValue& value, std::string& bytes )
+{
+	if ( const int32_t * number = std::get_if<int32_t>( &value ) ) { appendBytes( bytes, *number ); return TAG_INT32; }
+	if ( const std::string * text = std::get_if<std::string>( &value ) ) { bytes.append( *text ); return TAG_STRING; }
+	if ( const uint32_t * number = std::get_if<uint32_t>( &value ) ) { appendBytes( bytes, *number ); return TAG_UINT32; }
+	if ( const uint64_t * number = std::get_if<uint64_t>( &value ) ) { appendBytes( bytes, *number ); return TAG_UINT64; }
+	if ( const IpAddress * address = std::get_if<IpAddress>( &value ) ) { appendBytes( bytes, address->octets ); return TAG_IP_ADDRESS; }
+	if ( const float * number = std::get_if<float>( &value ) ) { appendBytes( bytes, *number ); return TAG_FLOAT; }
+	if ( const double * number = std::get_if<double>( &value ) ) { appendBytes( bytes, *number ); return TAG_DOUBLE; }
+	return TAG_NONE;
+}
+
+template <typename T>
+snmpGetValue readValue( const unsigned char * bytes, size_t length )
+{
+	T value{};
+	if ( length == sizeof value )
+		std::memcpy( &value, bytes, sizeof value );
+	return value;
+}
+
+}
+
+struct SnmpWalkSnapshot::Header
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t entryCount;
+	// wall clock at capture, us since the epoch
+	uint64_t capturedAtUs;
+	// sysUpTime at capture, in hundredths of a second, if flags has FLAG_UP_TIME
+	uint32_t upTime;
+	uint32_t flags;
+	// file offsets of the sub-identifiers (uint32_t each) and of the values
+	uint64_t oidsOffset;
+	uint64_t valuesOffset;
+	uint64_t fileSize;
+	uint64_t reserved;
+};
+
+struct SnmpWalkSnapshot::Entry
+{
+	// in sub-identifiers from oidsOffset
+	uint64_t oidOffset;
+	// in bytes from valuesOffset
+	uint64_t valueOffset;
+	uint32_t oidLength;
+	uint32_t valueLength;
+	uint32_t status;
+	uint8_t tag;
+	uint8_t padding[3];
+};
+
+size_t SnmpWalkSnapshot::capture( SnmpBackend& backend, const std::vector<Oid>& rootOids, const std::string& path )
+{
+
+	LOG(Log::INF, LogComponentLevels::mule()) << "Capturing walk snapshot of " << backend.getHostName() << " to " << path;
+
+	Header header{};
+	std::memcpy( header.magic, MAGIC, sizeof MAGIC );
+	header.version = VERSION;
+	header.capturedAtUs = wallClockUs();
+
+	// Before the walk: a restart during the walk then shows as a restart on validation
+	const SnmpResult<TimeTicks> upTime = backend.trySnmpGet<TimeTicks>( Oid( SYS_UP_TIME, sizeof SYS_UP_TIME / sizeof SYS_UP_TIME[0] ) );
+	if ( upTime.ok() )
+	{
+		header.upTime = upTime.value.hundredths;
+		header.flags |= FLAG_UP_TIME;
+	}
+	else
+		LOG(Log::WRN, LogComponentLevels::mule()) << "No sysUpTime from " << backend.getHostName() << " (" << upTime.error.toString() << "), snapshot validated by samples only";
+
+	struct Walked
+	{
+		Oid name;
+		SnmpStatus status;
+		snmpGetValue value;
+	};
+	std::vector<Walked> walked;
+	for ( const Oid& rootOid : rootOids )
+	{
+		backend.snmpWalk( rootOid, [&walked] ( const Oid& name, SnmpStatus status, const snmpGetValue& value ) {
+			walked.push_back( Walked{ name, status, value } );
+			return true;
+		});
+	}
+
+	// Overlapping roots give the same OIDs twice
+	std::stable_sort( walked.begin(), walked.end(), [] ( const Walked& a, const Walked& b ) { return a.name < b.name; } );
+	walked.erase( std::unique( walked.begin(), walked.end(), [] ( const Walked& a, const Walked& b ) { return a.name == b.name; } ), walked.end() );
+
+	std::vector<Entry> entries;
+	entries.reserve( walked.size() );
+	std::vector<uint32_t> subIdentifiers;
+	std::string values;
+	for ( const Walked& item : walked )
+	{
+		Entry entry{};
+		entry.oidOffset = subIdentifiers.size();
+		entry.oidLength = item.name.size();
+		entry.valueOffset = values.size();
+		entry.status = item.status;
+		entry.tag = encodeValue( item.value, values );
+		entry.valueLength = values.size() - entry.valueOffset;
+		for ( size_t i = 0; i < item.name.size(); i++ )
+			subIdentifiers.push_back( static_cast<uint32_t>( item.name[i] ) );
+		entries.push_back( entry );
+	}
+
+	header.entryCount = entries.size();
+	header.oidsOffset = sizeof(Header) + entries.size() * sizeof(Entry);
+	header.valuesOffset = header.oidsOffset + subIdentifiers.size() * sizeof(uint32_t);
+	header.fileSize = header.valuesOffset + values.size();
+
+	// Written aside and renamed, a reader never maps a half written snapshot
+	const std::string temporaryPath = path + ".tmp";
+	{
+		std::ofstream output( temporaryPath, std::ios::binary | std::ios::trunc );
+		if ( !output )
+			snmp_throw_runtime_error_with_origin("Cannot open snapshot file " + temporaryPath);
+
+		output.write( reinterpret_cast<const char*>(&header), sizeof header );
+		output.write( reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(Entry) );
+		output.write( reinterpret_cast<const char*>(subIdentifiers.data()), subIdentifiers.size() * sizeof(uint32_t) );
+		output.write( values.data(), values.size() );
+
+		if ( !output.flush() )
+			snmp_throw_runtime_error_with_origin("Failed writing snapshot file " + temporaryPath);
+	}
+	if ( std::rename( temporaryPath.c_str(), path.c_str() ) != 0 )
+		snmp_throw_runtime_error_with_origin("Cannot replace snapshot file " + path);
+
+	LOG(Log::INF, LogComponentLevels::mule()) << "Walk snapshot of " << backend.getHostName() << " holds " << entries.size() << " OIDs";
+
+	return entries.size();
+
+}
+
+SnmpWalkSnapshot::SnmpWalkSnapshot( const std::string& path ) :
+	m_path(path),
+	m_data(nullptr),
+	m_size(0)
+{
+
+	static_assert( sizeof(Header) == 64 && sizeof(Entry) == 32, "layout of the snapshot file" );
+
+	const int fd = open( path.c_str(), O_RDONLY );
+	if ( fd < 0 )
+		snmp_throw_runtime_error_with_origin("Cannot open snapshot file " + path);
+
+	struct stat status;
+	if ( fstat( fd, &status ) != 0 || static_cast<size_t>(status.st_size) < sizeof(Header) )
+	{
+		close( fd );
+		snmp_throw_runtime_error_with_origin("Not a walk snapshot: " + path);
+	}
+
+	m_size = status.st_size;
+	void * mapped = mmap( nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+	// The mapping stays valid without the descriptor
+	close( fd );
+	if ( mapped == MAP_FAILED )
+		snmp_throw_runtime_error_with_origin("Cannot map snapshot file " + path);
+	m_data = static_cast<const unsigned char*>( mapped );
+
+	// Bounds are checked once here, accessors trust them afterwards
+	const Header& header = *reinterpret_cast<const Header*>( m_data );
+	bool valid = std::memcmp( header.magic, MAGIC, sizeof MAGIC ) == 0 && header.version == VERSION &&
+		header.fileSize == m_size &&
+		header.oidsOffset == sizeof(Header) + static_cast<uint64_t>(header.entryCount) * sizeof(Entry) &&
+		header.oidsOffset <= header.valuesOffset && header.valuesOffset <= m_size;
+
+	const uint64_t subIdentifierCount = valid ? ( header.valuesOffset - header.oidsOffset ) / sizeof(uint32_t) : 0;
+	const uint64_t valueBytes = valid ? m_size - header.valuesOffset : 0;
+	for ( size_t i = 0; valid && i < header.entryCount; i++ )
+	{
+		const Entry& current = entry( i );
+		// Offsets come from the file, compared without adding so that huge ones cannot wrap
+		valid = current.oidLength <= MAX_OID_LEN &&
+			current.oidLength <= subIdentifierCount && current.oidOffset <= subIdentifierCount - current.oidLength &&
+			current.valueLength <= valueBytes && current.valueOffset <= valueBytes - current.valueLength;
+	}
+
+	if ( !valid )
+	{
+		munmap( const_cast<unsigned char*>(m_data), m_size );
+		snmp_throw_runtime_error_with_origin("Not a walk snapshot or corrupt: " + path);
+	}
+
+	LOG(Log::DBG, LogComponentLevels::mule()) << "Mapped walk snapshot " << path << " of " << header.entryCount << " OIDs";
+
+}
+
+SnmpWalkSnapshot::~SnmpWalkSnapshot()
+{
+
+	munmap( const_cast<unsigned char*>(m_data), m_size );
+
+}
+
+size_t SnmpWalkSnapshot::size() const
+{
+
+	return reinterpret_cast<const Header*>( m_data )->entryCount;
+
+}
+
+const SnmpWalkSnapshot::Entry& SnmpWalkSnapshot::entry( size_t position ) const
+{
+
+	return reinterpret_cast<const Entry*>( m_data + sizeof(Header) )[position];
+
+}
+
+Oid SnmpWalkSnapshot::oidAt( size_t position ) const
+{
+
+	const Entry& current = entry( position );
+	const Header& header = *reinterpret_cast<const Header*>( m_data );
+
+	oid subIdentifiers[MAX_OID_LEN];
+	const unsigned char * stored = m_data + header.oidsOffset + current.oidOffset * sizeof(uint32_t);
+	for ( size_t i = 0; i < current.oidLength; i++ )
+	{
+		uint32_t subIdentifier;
+		std::memcpy( &subIdentifier, stored + i * sizeof subIdentifier, sizeof subIdentifier );
+		subIdentifiers[i] = subIdentifier;
+	}
+	return Oid( subIdentifiers, current.oidLength );
+
+}
+
+std::pair<SnmpStatus, snmpGetValue> SnmpWalkSnapshot::valueAt( size_t position ) const
+{
+
+	const Entry& current = entry( position );
+	const Header& header = *reinterpret_cast<const Header*>( m_data );
+	const unsigned char * bytes = m_data + header.valuesOffset + current.valueOffset;
+	const SnmpStatus status = static_cast<SnmpStatus>( current.status );
+
+	switch ( current.tag )
+	{
+		case TAG_INT32: return { status, readValue<int32_t>( bytes, current.valueLength ) };
+		case TAG_STRING: return { status, std::string( reinterpret_cast<const char*>(bytes), current.valueLength ) };
+		case TAG_UINT32: return { status, readValue<uint32_t>( bytes, current.valueLength ) };
+		case TAG_UINT64: return { status, readValue<uint64_t>( bytes, current.valueLength ) };
+		case TAG_IP_ADDRESS: return { status, readValue<IpAddress>( bytes, current.valueLength ) };
+		case TAG_FLOAT: return { status, readValue<float>( bytes, current.valueLength ) };
+		case TAG_DOUBLE: return { status, readValue<double>( bytes, current.valueLength ) };
+		default: return { status, std::monostate() };
+	}
+
+}
+
+int SnmpWalkSnapshot::compare( const Entry& current, const Oid& oidOfInterest ) const
+{
+
+	const Header& header = *reinterpret_cast<const Header*>( m_data );
+	const unsigned char * stored = m_data + header.oidsOffset + current.oidOffset * sizeof(uint32_t);
+	const size_t common = std::min<size_t>( current.oidLength, oidOfInterest.size() );
+	for ( size_t i = 0; i < common; i++ )
+	{
+		uint32_t subIdentifier;
+		std::memcpy( &subIdentifier, stored + i * sizeof subIdentifier, sizeof subIdentifier );
+		if ( subIdentifier != oidOfInterest[i] )
+			return subIdentifier < oidOfInterest[i] ? -1 : 1;
+	}
+	return current.oidLength < oidOfInterest.size() ? -1 : ( current.oidLength > oidOfInterest.size() ? 1 : 0 );
+
+}
+
+size_t SnmpWalkSnapshot::lowerBound( const Oid& oidOfInterest ) const
+{
+
+	size_t first = 0;
+	size_t count = size();
+	while ( count > 0 )
+	{
+		const size_t half = count / 2;
+		if ( compare( entry( first + half ), oidOfInterest ) < 0 )
+		{
+			first += half + 1;
+			count -= half + 1;
+		}
+		else
+			count = half;
+	}
+	return first;
+
+}
+
+size_t SnmpWalkSnapshot::find( const Oid& oidOfInterest ) const
+{
+
+	const size_t position = lowerBound( oidOfInterest );
+	return ( position < size() && compare( entry( position ), oidOfInterest ) == 0 ) ? position : size();
+
+}
+
+size_t SnmpWalkSnapshot::walk( const Oid& rootOid, const SnmpBackend::WalkVisitor& visitor ) const
+{
+
+	size_t visited = 0;
+	for ( size_t position = lowerBound( rootOid ); position < size(); position++ )
+	{
+		const Oid name = oidAt( position );
+		if ( !rootOid.isPrefixOf( name ) )
+			break;
+		// The walk starts after its root
+		if ( name.size() == rootOid.size() )
+			continue;
+		const auto value = valueAt( position );
+		visited++;
+		if ( !visitor( name, value.first, value.second ) )
+			break;
+	}
+	return visited;
+
+}
+
+std::vector<Oid> SnmpWalkSnapshot::deviceWalk( const Oid& seedOid ) const
+{
+
+	std::vector<Oid> walkedOids;
+	Oid currentDeviceOid = seedOid;
+
+	size_t position = lowerBound( seedOid );
+	if ( position < size() && compare( entry( position ), seedOid ) == 0 )
+		position++;
+
+	// Same end criteria as SnmpBackend::isEndOfWalk
+	for ( ; position < size(); position++ )
+	{
+		const Oid nextDeviceOid = oidAt( position );
+		if ( currentDeviceOid.size() != nextDeviceOid.size() || nextDeviceOid.size() < 2 ||
+			currentDeviceOid[currentDeviceOid.size() - 2] != nextDeviceOid[nextDeviceOid.size() - 2] )
+			break;
+		walkedOids.push_back( nextDeviceOid );
+		currentDeviceOid = nextDeviceOid;
+	}
+
+	return walkedOids;
+
+}
+
+SnmpWalkSnapshot::Validation SnmpWalkSnapshot::validate( SnmpBackend& backend, size_t samples ) const
+{
+
+	const Header& header = *reinterpret_cast<const Header*>( m_data );
+
+	// sysUpTime first, then OIDs spread evenly from the first to the last
+	std::vector<Oid> oids( 1, Oid( SYS_UP_TIME, sizeof SYS_UP_TIME / sizeof SYS_UP_TIME[0] ) );
+	std::vector<size_t> positions;
+	const size_t count = std::min( samples, size() );
+	for ( size_t i = 0; i < count; i++ )
+	{
+		positions.push_back( count > 1 ? i * (size() - 1) / (count - 1) : 0 );
+		oids.push_back( oidAt( positions.back() ) );
+	}
+
+	const auto results = backend.snmpGetMany( oids );
+
+	bool answered = false;
+	for ( const auto& result : results )
+		answered = answered || ( result.first != Snmp_BadTimeout && result.first != Snmp_BadCommunicationError && result.first != Snmp_BadNoCommunication );
+	if ( !answered )
+		return Validation::Unreachable;
+
+	// Only an OID the agent no longer has tells the tree changed, a value it cannot read right
+	// now or one in a type not decoded says nothing about the capture
+	for ( size_t i = 1; i < results.size(); i++ )
+	{
+		if ( results[i].first == Snmp_BadNoDataAvailable && static_cast<SnmpStatus>( entry( positions[i - 1] ).status ) != Snmp_BadNoDataAvailable )
+		{
+			LOG(Log::INF, LogComponentLevels::mule()) << "Walk snapshot " << m_path << " outdated, " << oids[i] << " not on " << backend.getHostName();
+			return Validation::Changed;
+		}
+	}
+
+	const uint32_t * upTime = std::get_if<uint32_t>( &results[0].second );
+	if ( ( header.flags & FLAG_UP_TIME ) && results[0].first == Snmp_Good && upTime )
+	{
+		// Expected now had the agent kept running since the capture, in hundredths of a second
+		const uint64_t now = wallClockUs();
+		const uint64_t elapsed = now > header.capturedAtUs ? ( now - header.capturedAtUs ) / 10000 : 0;
+		const uint64_t tolerance = Constants::SNMP_SNAPSHOT_UPTIME_TOLERANCE / 10000;
+		if ( *upTime < header.upTime || *upTime + tolerance < header.upTime + elapsed )
+		{
+			LOG(Log::INF, LogComponentLevels::mule()) << "Walk snapshot " << m_path << ": " << backend.getHostName() << " restarted since the capture";
+			return Validation::Restarted;
+		}
+	}
+
+	return Validation::Valid;
+
+}
+
+const char * SnmpWalkSnapshot::validationToString( Validation validation )
+{
+
+	switch ( validation )
+	{
+		case Validation::Valid: return "valid";
+		case Validation::Restarted: return "restarted";
+		case Validation::Changed: return "changed";
+		case Validation::Unreachable: return "unreachable";
+	}
+	return "unknown";
+
+}
+
+} // Snmp
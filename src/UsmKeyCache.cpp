@@ -0,0 +1,109 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <UsmKeyCache.h>
+#include <SnmpExceptions.h>
+#include <MuleLogComponents.h>
+
+using Mule::LogComponentLevels;
+
+namespace Snmp
+{
+
+UsmKeyCache& UsmKeyCache::instance()
+{
+
+	static UsmKeyCache cache;
+	return cache;
+
+}
+
+std::vector<u_char> UsmKeyCache::getKu( const oid * protocol, size_t protocolLength, const std::string& passPhrase )
+{
+
+	const std::string key = cacheKey( protocol, protocolLength, passPhrase );
+
+	{
+		std::lock_guard<std::mutex> guard(m_mutex);
+		auto cached = m_keys.find( key );
+		if ( cached != m_keys.end() )
+			return cached->second;
+	}
+
+	// Derived outside of the lock, it takes a while
+	u_char ku[SNMP_MAXBUF_SMALL];
+	size_t kuLength = sizeof ku;
+	if ( generate_Ku( protocol, protocolLength, (u_char *) passPhrase.c_str(), passPhrase.size(), ku, &kuLength ) != SNMPERR_SUCCESS )
+	{
+		snmp_perror("mule");
+		snmp_throw_runtime_error_with_origin("Failed to generate Ku from pass phrase");
+	}
+
+	std::vector<u_char> derivedKey( ku, ku + kuLength );
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	m_keys.emplace( key, derivedKey );
+	LOG(Log::DBG, LogComponentLevels::mule()) << "Cached Ku of length [" << kuLength << "], " << m_keys.size() << " keys cached";
+
+	return derivedKey;
+
+}
+
+std::string UsmKeyCache::cacheKey( const oid * protocol, size_t protocolLength, const std::string& passPhrase )
+{
+
+	u_char digest[SNMP_MAXBUF_SMALL];
+	size_t digestLength = sizeof digest;
+	if ( sc_hash( usmHMACSHA1AuthProtocol, USM_AUTH_PROTO_SHA_LEN, (const u_char *) passPhrase.c_str(), passPhrase.size(), digest, &digestLength ) != SNMPERR_SUCCESS )
+		snmp_throw_runtime_error_with_origin("Failed to hash pass phrase");
+
+	std::string key( reinterpret_cast<const char*>(protocol), protocolLength * sizeof(oid) );
+	key.append( reinterpret_cast<const char*>(digest), digestLength );
+	return key;
+
+}
+
+size_t UsmKeyCache::size() const
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	return m_keys.size();
+
+}
+
+void UsmKeyCache::clear()
+{
+
+	std::lock_guard<std::mutex> guard(m_mutex);
+	m_keys.clear();
+
+}
+
+}
@@ -0,0 +1,163 @@
+/* 
+ * @author:     Paris Moschovakos <paris.moschovakos@cern.ch>
+ * 
+ * @copyright:  2026 CERN
+ * 
+ * @license:
+ * LICENSE:
+ * Copyright (c) 2026, CERN
+ * All rights reserved.
+ * 
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT  HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS  OR IMPLIED  WARRANTIES, INCLUDING, BUT NOT  LIMITED TO, THE IMPLIED
+ * WARRANTIES  OF  MERCHANTABILITY  AND  FITNESS  FOR  A  PARTICULAR  PURPOSE  ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL,  SPECIAL, EXEMPLARY, OR  CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT  NOT LIMITED TO,  PROCUREMENT OF  SUBSTITUTE GOODS OR  SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS  INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY  THEORY  OF  LIABILITY,   WHETHER IN  CONTRACT, STRICT  LIABILITY,  OR  TORT
+ * (INCLUDING  NEGLIGENCE OR OTHERWISE)  ARISING IN ANY WAY OUT OF  THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ * 
+ */
+
+#include <WorkStealingThreadPool.h>
+#include <MuleLogComponents.h>
+
+#include <algorithm>
+
+using Mule::LogComponentLevels;
+
+namespace Snmp
+{
+
+/*
+ *	Identity of the current worker, used to keep tasks submitted from a worker local to it
+ */
+static thread_local const WorkStealingThreadPool * t_pool = nullptr;
+static thread_local size_t t_workerIndex = 0;
+
+WorkStealingThreadPool::WorkStealingThreadPool( size_t threads ) :
+				m_queuedTasks(0),
+				m_nextQueue(0),
+				m_running(true)
+{
+
+	threads = std::max<size_t>( threads, 1 );
+
+	for ( size_t i = 0; i < threads; i++ )
+		m_queues.push_back( std::make_unique<WorkerQueue>() );
+
+	for ( size_t i = 0; i < threads; i++ )
+		m_threads.emplace_back( &WorkStealingThreadPool::workerLoop, this, i );
+
+	LOG(Log::INF, LogComponentLevels::mule()) << "Started work stealing thread pool with " << threads << " workers";
+
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+
+	{
+		std::lock_guard<std::mutex> guard(m_idleMutex);
+		m_running = false;
+	}
+	m_idleCondition.notify_all();
+
+	for ( auto& thread : m_threads )
+		thread.join();
+
+}
+
+void WorkStealingThreadPool::submit( Task task )
+{
+
+	const size_t index = ( t_pool == this ) ? t_workerIndex : m_nextQueue++ % m_queues.size();
+
+	// Counted before being visible, a worker popping it right away must not take the count below zero
+	{
+		std::lock_guard<std::mutex> guard(m_idleMutex);
+		m_queuedTasks++;
+	}
+
+	{
+		std::lock_guard<std::mutex> guard(m_queues[index]->mutex);
+		m_queues[index]->tasks.push_back( std::move(task) );
+	}
+	m_idleCondition.notify_one();
+
+}
+
+void WorkStealingThreadPool::workerLoop( size_t index )
+{
+
+	t_pool = this;
+	t_workerIndex = index;
+
+	while ( true )
+	{
+
+		Task task;
+		if ( popLocal( index, task ) || steal( index, task ) )
+		{
+			m_queuedTasks--;
+			try
+			{
+				task();
+			}
+			catch (const std::exception& e)
+			{
+				LOG(Log::ERR, LogComponentLevels::mule()) << "Thread pool task threw: " << e.what();
+			}
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(m_idleMutex);
+		if ( !m_running && m_queuedTasks == 0 )
+			break;
+		m_idleCondition.wait( lock, [this] { return m_queuedTasks > 0 || !m_running; } );
+
+	}
+
+}
+
+bool WorkStealingThreadPool::popLocal( size_t index, Task& task )
+{
+
+	std::lock_guard<std::mutex> guard(m_queues[index]->mutex);
+	if ( m_queues[index]->tasks.empty() )
+		return false;
+
+	task = std::move( m_queues[index]->tasks.back() );
+	m_queues[index]->tasks.pop_back();
+	return true;
+
+}
+
+bool WorkStealingThreadPool::steal( size_t index, Task& task )
+{
+
+	for ( size_t offset = 1; offset < m_queues.size(); offset++ )
+	{
+		WorkerQueue& victim = *m_queues[ (index + offset) % m_queues.size() ];
+
+		std::lock_guard<std::mutex> guard(victim.mutex);
+		if ( victim.tasks.empty() )
+			continue;
+
+		task = std::move( victim.tasks.front() );
+		victim.tasks.pop_front();
+		return true;
+	}
+	return false;
+
+}
+
+}